@@ -0,0 +1,110 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino sketch for LiquidCrystal_I2C library
+
+   This device uses I2C bus to communicate, specials pins are required to interface
+   Board                                     SDA              SCL              Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... A4               A5               5v
+   Mega2560................................. 20               21               5v
+   Due, SAM3X8E............................. 20               21               3.3v
+   MKR Zero, XIAO SAMD21, SAMD21xx.......... PA08             PA09             3.3v
+   Leonardo, Micro, ATmega32U4.............. 2                3                5v
+   Digistump, Trinket, Gemma, ATtiny85...... PB0/D0           PB2/D2           3.3v/5v
+   Blue Pill*, STM32F103xxxx boards*........ PB7/PB9          PB6/PB8          3.3v/5v
+   ESP8266 ESP-01**......................... GPIO0            GPIO2            3.3v/5v
+   NodeMCU 1.0**, WeMos D1 Mini**........... GPIO4/D2         GPIO5/D1         3.3v/5v
+   ESP32***................................. GPIO21/D21       GPIO22/D22       3.3v
+                                             GPIO16/D16       GPIO17/D17       3.3v
+                                            *hardware I2C Wire mapped to Wire1 in stm32duino
+                                             see https://github.com/stm32duino/wiki/wiki/API#I2C
+                                           **most boards has 10K..12K pullup-up resistor
+                                             on GPIO0/D3, GPIO2/D4/LED & pullup-down on
+                                             GPIO15/D8 for flash & boot
+                                          ***hardware I2C Wire mapped to TwoWire(0) aka GPIO21/GPIO22 in Arduino ESP32
+
+   Supported frameworks:
+   Arduino Core - https://github.com/arduino/Arduino/tree/master/hardware
+   ATtiny  Core - https://github.com/SpenceKonde/ATTinyCore
+   ESP8266 Core - https://github.com/esp8266/Arduino
+   ESP32   Core - https://github.com/espressif/arduino-esp32
+   STM32   Core - https://github.com/stm32duino/Arduino_Core_STM32
+   SAMD    Core - https://github.com/arduino/ArduinoCore-samd
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#pragma GCC optimize ("O3") //code optimisation controls - "O2" & "O3" code performance, "Os" code size
+
+#include <Wire.h> 
+#include <LiquidCrystal_I2C.h>
+#include <LiquidCrystal_I2C_Animation.h>
+
+#define COLUMS           20   //LCD columns
+#define ROWS             4    //LCD rows
+#define ALARM_PIN        2    //alarm input pin
+
+
+LiquidCrystal_I2C lcd(PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE);
+
+const uint8_t spinner[4][8] PROGMEM =                   //frames in MCU flash memory
+{
+  {0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},     //"|" upper half
+  {0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00},     //"/"
+  {0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00},     //"-"
+  {0x00, 0x00, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00}      //"\"
+};
+
+const uint8_t bell[2][8] PROGMEM =
+{
+  {0x04, 0x0E, 0x0E, 0x0E, 0x1F, 0x00, 0x04, 0x00},     //bell icon
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}      //blank
+};
+
+LiquidCrystal_I2C_Animation busy(lcd,  0, spinner[0], 4, 150); //lcd, CGRAM slot, 1-st frame, quantity of frames, frame time in milliseconds
+LiquidCrystal_I2C_Animation alarm(lcd, 1, bell[0],    2, 500);
+
+uint32_t counter = 0;
+
+void setup()
+{
+  Serial.begin(115200);
+
+  pinMode(ALARM_PIN, INPUT_PULLUP);
+
+  while (lcd.begin(COLUMS, ROWS, LCD_5x8DOTS) != 1) //colums, rows, characters size
+  {
+    Serial.println(F("PCF8574 is not connected or lcd pins declaration is wrong. Only pins numbers: 4,5,6,16,11,12,13,14 are legal."));
+    delay(5000);   
+  }
+
+  lcd.print(F("PCF8574 is OK...")); //(F()) saves string to flash & keeps dynamic memory free
+  delay(2000);
+
+  lcd.clear();
+
+  busy.begin();                     //uploads the 1-st frame to CGRAM
+  alarm.begin();
+
+  lcd.print(F("Working "));
+  lcd.write((uint8_t)0);            //spinner, printed once, animated in CGRAM
+  lcd.setCursor(19, 0);
+  lcd.write(1);                     //alarm icon
+
+  lcd.setCursor(0, 1);
+  lcd.print(F("Count:"));
+}
+
+void loop()
+{
+  busy.tick();                      //8 CGRAM bytes per frame, no DDRAM writes
+
+  if (digitalRead(ALARM_PIN) == LOW) {alarm.play();}
+  else                               {alarm.pause(); alarm.setFrame(1);} //blank icon, "setFrame()" uploads frame right away
+
+  alarm.tick();
+
+  lcd.setCursor(6, 1);
+  lcd.print(counter++);             //cursor isn't disturbed by animations
+}
@@ -39,6 +39,7 @@
 
 #include <Wire.h> 
 #include <LiquidCrystal_I2C.h>
+#include <LiquidCrystal_I2C_Meter.h>
 
 #define COLUMS    20 //LCD columns
 #define ROWS      4  //LCD rows
@@ -48,6 +49,9 @@
 
 LiquidCrystal_I2C lcd(PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE);
 
+LiquidCrystal_I2C_Meter lBar(lcd, LCD_METER_HORIZONTAL, 1, 0, COLUMS - 1); //lcd, meter type, 1-st column, 1-st row, length in characters, both bars share CGRAM slots 0..3
+LiquidCrystal_I2C_Meter rBar(lcd, LCD_METER_HORIZONTAL, 1, 1, COLUMS - 1);
+
 void setup()
 {
   Serial.begin(115200);
@@ -62,10 +66,18 @@ void setup()
   delay(2000);
 
   lcd.clear();
+
+  lcd.setCursor(0, 0);
+  lcd.write('L');                                                   //bar name, 1-st row
+  lcd.setCursor(0, 1);
+  lcd.write('R');                                                   //bar name, 2-nd row
+
+  lBar.begin();                                                     //uploads partial blocks to CGRAM & draws empty bar
+  rBar.begin();
 }
 
 void loop()
 {
-  lcd.printHorizontalGraph('L', 0, analogRead(L_CHANNEL), 1023); //bar name, 1-st  row, current value, maximum value
-  lcd.printHorizontalGraph('R', 1, analogRead(R_CHANNEL), 1023); //bar name, 2-nd  row, current value, maximum value
+  lBar.draw(analogRead(L_CHANNEL), 1023);                           //current value, maximum value, only changed characters are sent
+  rBar.draw(analogRead(R_CHANNEL), 1023);
 }
@@ -0,0 +1,110 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino sketch for LiquidCrystal_I2C library
+
+   This device uses I2C bus to communicate, specials pins are required to interface
+   Board                                     SDA              SCL              Level
+   Uno, Mini, Pro, ATmega168, ATmega328..... A4               A5               5v
+   Mega2560................................. 20               21               5v
+   Due, SAM3X8E............................. 20               21               3.3v
+   MKR Zero, XIAO SAMD21, SAMD21xx.......... PA08             PA09             3.3v
+   Leonardo, Micro, ATmega32U4.............. 2                3                5v
+   Digistump, Trinket, Gemma, ATtiny85...... PB0/D0           PB2/D2           3.3v/5v
+   Blue Pill*, STM32F103xxxx boards*........ PB7/PB9          PB6/PB8          3.3v/5v
+   ESP8266 ESP-01**......................... GPIO0            GPIO2            3.3v/5v
+   NodeMCU 1.0**, WeMos D1 Mini**........... GPIO4/D2         GPIO5/D1         3.3v/5v
+   ESP32***................................. GPIO21/D21       GPIO22/D22       3.3v
+                                             GPIO16/D16       GPIO17/D17       3.3v
+                                            *hardware I2C Wire mapped to Wire1 in stm32duino
+                                             see https://github.com/stm32duino/wiki/wiki/API#I2C
+                                           **most boards has 10K..12K pullup-up resistor
+                                             on GPIO0/D3, GPIO2/D4/LED & pullup-down on
+                                             GPIO15/D8 for flash & boot
+                                          ***hardware I2C Wire mapped to TwoWire(0) aka GPIO21/GPIO22 in Arduino ESP32
+
+   Supported frameworks:
+   Arduino Core - https://github.com/arduino/Arduino/tree/master/hardware
+   ATtiny  Core - https://github.com/SpenceKonde/ATTinyCore
+   ESP8266 Core - https://github.com/esp8266/Arduino
+   ESP32   Core - https://github.com/espressif/arduino-esp32
+   STM32   Core - https://github.com/stm32duino/Arduino_Core_STM32
+   SAMD    Core - https://github.com/arduino/ArduinoCore-samd
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#pragma GCC optimize ("O3") //code optimisation controls - "O2" & "O3" code performance, "Os" code size
+
+#include <Wire.h> 
+#include <LiquidCrystal_I2C.h>
+#include <LiquidCrystal_I2C_Mailbox.h>
+
+#define COLUMS           20   //LCD columns
+#define ROWS             4    //LCD rows
+
+
+LiquidCrystal_I2C lcd(PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE);
+
+uint8_t lcdMailbox[256];      //ring size is power of 2
+
+LiquidCrystal_I2C_Mailbox mailbox(lcd, lcdMailbox, sizeof(lcdMailbox), LCD_MAILBOX_MULTI_PRODUCER); //lcd, ring, ring size, many producers
+
+#if defined (ARDUINO_ARCH_ESP32)
+void sensorTask(void *parameter)                           //producer, never waits for I2C
+{
+  uint8_t row = (uint32_t)parameter;
+  char    text[21];
+
+  while (true)
+  {
+    snprintf(text, sizeof(text), "Task%u: %lu    ", row, millis());
+
+    mailbox.post(0, row, text);                            //copies text into the ring & returns
+
+    vTaskDelay(pdMS_TO_TICKS(100 * row));
+  }
+}
+#endif
+
+void setup()
+{
+  Serial.begin(115200);
+
+  while (lcd.begin(COLUMS, ROWS, LCD_5x8DOTS) != 1) //colums, rows, characters size
+  {
+    Serial.println(F("PCF8574 is not connected or lcd pins declaration is wrong. Only pins numbers: 4,5,6,16,11,12,13,14 are legal."));
+    delay(5000);   
+  }
+
+  lcd.print(F("PCF8574 is OK...")); //(F()) saves string to flash & keeps dynamic memory free
+  delay(2000);
+
+  mailbox.postCommand(LCD_POST_CLEAR);
+
+  #if defined (ARDUINO_ARCH_ESP32)
+  xTaskCreate(sensorTask, "sensor1", 2048, (void *)1, 1, NULL);
+  xTaskCreate(sensorTask, "sensor2", 2048, (void *)2, 1, NULL);
+  xTaskCreate(sensorTask, "sensor3", 2048, (void *)3, 1, NULL);
+  #endif
+}
+
+void loop()
+{
+  #if !defined (ARDUINO_ARCH_ESP32)
+  char text[21];
+
+  snprintf(text, sizeof(text), "Loop: %lu    ", millis());
+
+  mailbox.post(0, 1, text);         //producer in "loop()" or timer interrupt
+  #endif
+
+  mailbox.drain();                  //owner of LCD, the only place where I2C is used
+
+  lcd.setCursor(0, 0);              //owner may use LCD directly
+  lcd.print(F("Dropped:"));
+  lcd.print(mailbox.getDropped());
+
+  delay(50);
+}
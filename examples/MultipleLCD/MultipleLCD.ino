@@ -37,11 +37,18 @@
 /***************************************************************************************************/
 #include <Wire.h>
 #include <LiquidCrystal_I2C.h>
+#include <LiquidCrystal_I2C_Scheduler.h>
 
 #define LCD_SPACE_SYMBOL 0x20 //space symbol from LCD ROM, see p.9 of GDM2004D datasheet
  
 LiquidCrystal_I2C lcd_01(PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE); //all three address pads on the PCF8574 shield are open
 LiquidCrystal_I2C lcd_02(PCF8574_ADDR_A20_A10_A00, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE); //all three address pads on the PCF8574 shield are shorted
+
+LiquidCrystal_I2C_Scheduler lcdGroup;                                                      //interleaves both LCD on one I2C bus
+
+uint8_t  lcdQueue_01[LCD_QUEUE_SIZE(64)];                                                  //queue for 64 commands & characters
+uint8_t  lcdQueue_02[LCD_QUEUE_SIZE(64)];
+uint32_t lastUpdate = 0;
  
 
 void setup()
@@ -58,7 +65,13 @@ void setup()
   lcd_02.print(F("PCF8574_02 is OK..."));
   delay(2000);
 
-  lcd_01.clear();
+  lcd_01.enableQueue(lcdQueue_01, sizeof(lcdQueue_01)); //from now every LCD function returns immediately
+  lcd_02.enableQueue(lcdQueue_02, sizeof(lcdQueue_02));
+
+  lcdGroup.add(lcd_01);
+  lcdGroup.add(lcd_02);
+
+  lcd_01.clear();                         //while lcd_01 executes "clear()", lcd_02 receives data
   lcd_02.clear();
 
   /* prints static text */
@@ -75,6 +88,12 @@ void setup()
 
 void loop()
 {
+  lcdGroup.tick();                        //sends queued data to every LCD which is ready, never waits
+
+  if ((millis() - lastUpdate) < 1000) {return;}
+
+  lastUpdate = millis();
+
   /* prints dynamic text */
   lcd_01.setCursor(14, 2);                //set 15-th colum & 3-rd  row, 1-st colum & row started at zero
   lcd_01.print(random(10, 1000));
@@ -83,6 +102,4 @@ void loop()
   lcd_02.setCursor(14, 1);                //set 15-th colum & 2-rd  row, 1-st colum & row started at zero
   lcd_02.print(random(10, 1000));
   lcd_02.write(LCD_SPACE_SYMBOL);
-
-  delay(1000);
 }
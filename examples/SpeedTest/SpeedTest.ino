@@ -51,7 +51,6 @@
 
 #define COLUMS        20      //LCD columns
 #define ROWS          4       //LCD rows
-#define I2C_BUS_SPEED 400000  //I2C bus speed 400000Hz
 #define ALPHABET_SIZE 26      //size of english alphabet array
 
 uint32_t startTimer;
@@ -69,13 +68,16 @@ void setup()
   
   Serial.begin(115200);
 
+  lcd.setBeginOptions(LCD_BEGIN_TUNE_SPEED);         //the fastest of 100kHz, 400kHz & 1MHz verified by DDRAM readback, LCD RW pin must be connected
+
   while (lcd.begin(COLUMS, ROWS, LCD_5x8DOTS) != 1)  //colums, rows, characters size
   {
     Serial.println(F("PCF8574 is not connected or lcd pins declaration is wrong. Only pins numbers: 4,5,6,16,11,12,13,14 are legal."));
     delay(5000);   
   }
 
-//Wire.setClock(I2C_BUS_SPEED);                      //change I2C bus speed
+  Serial.print(F("I2C speed, Hz: "));
+  Serial.println(lcd.getSpeed());                    //selected by "begin()", don't change it with "Wire.setClock()"
 
   lcd.print(F("PCF8574 is OK..."));                  //(F()) saves string to flash & keeps dynamic memory free
   delay(2000);
@@ -0,0 +1,35 @@
+/***************************************************************************************************/
+/*
+   Arduino API layer of LiquidCrystal_I2C for Linux & host tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - "Serial" prints to stdout
+   - no GPIO, "pinMode()" & "analogWrite()" do nothing, "setBrightness()"
+     has no effect
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <Arduino.h>
+
+HardwareSerial Serial;
+
+
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh)
+{
+  return (value - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void analogWrite(uint8_t, int)
+{
+}
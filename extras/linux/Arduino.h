@@ -0,0 +1,94 @@
+/***************************************************************************************************/
+/*
+   Arduino API layer of LiquidCrystal_I2C for Linux & host tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - only API used by the library, "Print" formats numbers with "printf()"
+   - "ARDUINO" isn't defined, library is built without "Wire", LCD needs bus
+     backend, e.g. "LiquidCrystal_I2C_LinuxI2C"
+   - "Clock.cpp" is time of Linux monotonic clock, host tests link virtual
+     time instead, see "extras/test"
+   - "millis()" & "micros()" return "uint32_t", so "micros() - startTime"
+     wraps at 32-bit same as on Arduino
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define OUTPUT                  0x01
+#define PROGMEM
+#define PSTR(s)                 (s)
+#define F(s)                    (reinterpret_cast<const __FlashStringHelper *>(s))
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define bitRead(value, bit)     (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit)      ((value) |= (1UL << (bit)))
+#define bitClear(value, bit)    ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+
+long          map(long value, long fromLow, long fromHigh, long toLow, long toHigh);
+uint32_t      millis();                 //32-bit like on Arduino, "unsigned long" is 64-bit on Linux
+uint32_t      micros();
+void          delay(unsigned long ms);
+void          delayMicroseconds(unsigned int us);
+void          pinMode(uint8_t pin, uint8_t mode);
+void          analogWrite(uint8_t pin, int value);
+
+
+class Print
+{
+  public:
+   virtual ~Print() {}
+
+   virtual size_t write(uint8_t character) = 0;
+   virtual size_t write(const uint8_t *buffer, size_t size) {size_t n = 0; while (size--) {n += write(*buffer++);} return n;}
+           size_t write(const char *str)                    {return (str == NULL) ? 0 : write((const uint8_t *)str, strlen(str));}
+           size_t write(const char *buffer, size_t size)    {return write((const uint8_t *)buffer, size);}
+
+   size_t print(const __FlashStringHelper *str)   {return write((const char *)str);}
+   size_t print(const char *str)                  {return write(str);}
+   size_t print(char character)                   {return write((uint8_t)character);}
+   size_t print(unsigned char value, int = 10)    {return print((unsigned long)value);}
+   size_t print(int value, int = 10)              {return print((long)value);}
+   size_t print(unsigned int value, int = 10)     {return print((unsigned long)value);}
+   size_t print(long value, int = 10)             {char text[24]; snprintf(text, sizeof(text), "%ld", value); return write(text);}
+   size_t print(unsigned long value, int = 10)    {char text[24]; snprintf(text, sizeof(text), "%lu", value); return write(text);}
+   size_t print(double value, int digits = 2)     {char text[32]; snprintf(text, sizeof(text), "%.*f", digits, value); return write(text);}
+
+   size_t println()                               {return write("\r\n");}
+   template <typename T> size_t println(T value)  {size_t n = print(value); return n + println();}
+
+   virtual void flush() {}
+};
+
+
+class HardwareSerial : public Print
+{
+  public:
+   void   begin(unsigned long) {}
+   size_t write(uint8_t character) {return fputc(character, stdout) == EOF ? 0 : 1;}
+   using  Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
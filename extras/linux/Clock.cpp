@@ -0,0 +1,70 @@
+/***************************************************************************************************/
+/*
+   Arduino time functions of LiquidCrystal_I2C for Linux
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - time since the first call, Linux monotonic clock
+   - "millis()" & "micros()" wrap at 32-bit like on Arduino, library keeps
+     timestamps in "uint32_t", see "Arduino.h"
+   - "delayMicroseconds()" sleeps, kernel timer slack may add ~50usec,
+     LCD commands are never shorter than requested
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <errno.h>
+#include <time.h>
+
+#include <Arduino.h>
+
+
+static uint64_t clockNow()
+{
+  static uint64_t start = 0;
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  uint64_t time = ((uint64_t)now.tv_sec * 1000000000ULL) + now.tv_nsec;
+
+  if (start == 0) {start = time;}
+
+  return time - start;
+}
+
+static void clockSleep(uint64_t nsec)
+{
+  struct timespec duration;
+
+  duration.tv_sec  = nsec / 1000000000ULL;
+  duration.tv_nsec = nsec % 1000000000ULL;
+
+  while ((nanosleep(&duration, &duration) != 0) && (errno == EINTR)) {} //continue after signal
+}
+
+
+uint32_t millis()
+{
+  return (uint32_t)(clockNow() / 1000000);
+}
+
+uint32_t micros()
+{
+  return (uint32_t)(clockNow() / 1000);
+}
+
+void delay(unsigned long ms)
+{
+  clockSleep((uint64_t)ms * 1000000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  clockSleep((uint64_t)us * 1000);
+}
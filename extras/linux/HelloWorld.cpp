@@ -0,0 +1,43 @@
+/***************************************************************************************************/
+/*
+   This is a Linux program for LiquidCrystal_I2C library, see "Makefile"
+
+   Prints "Hello world" on 16x2 LCD connected to "/dev/i2c-1", e.g. Raspberry Pi
+   GPIO2/SDA & GPIO3/SCL
+
+   NOTE:
+   - enable I2C & load "i2c-dev" module, user needs access to "/dev/i2c-N",
+     e.g. member of "i2c" group
+   - usage: ./HelloWorld [/dev/i2c-N]
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+#include <LiquidCrystal_I2C.h>
+#include <LiquidCrystal_I2C_LinuxI2C.h>
+
+#define COLUMNS 16   //LCD columns
+#define ROWS    2    //LCD rows
+
+
+int main(int argc, char **argv)
+{
+  LiquidCrystal_I2C_LinuxI2C bus((argc > 1) ? argv[1] : "/dev/i2c-1");
+  LiquidCrystal_I2C          lcd(bus, PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE);
+
+  if (lcd.begin(COLUMNS, ROWS, LCD_5x8DOTS, 100000) != true) //I2C speed is set by device tree, use the same value here
+  {
+    Serial.println(F("I2C adapter can't be opened, PCF8574 is not connected or lcd pins declaration is wrong"));
+
+    return 1;
+  }
+
+  lcd.print(F("Hello world"));
+  lcd.setCursor(0, 1);
+  lcd.print(F("uptime, ms: "));
+  lcd.print(millis());
+
+  return 0;
+}
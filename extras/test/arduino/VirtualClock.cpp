@@ -0,0 +1,44 @@
+/***************************************************************************************************/
+/*
+   Virtual time of LiquidCrystal_I2C host tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - see "VirtualClock.h" for details
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <Arduino.h>
+
+#include "VirtualClock.h"
+
+uint64_t hostTime = 0;
+
+
+uint32_t millis()
+{
+  return (uint32_t)(hostTime / 1000000);
+}
+
+uint32_t micros()
+{
+  hostTime += 1000;
+
+  return (uint32_t)(hostTime / 1000);
+}
+
+void delay(unsigned long ms)
+{
+  hostTime += (uint64_t)ms * 1000000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  hostTime += (uint64_t)us * 1000;
+}
@@ -0,0 +1,28 @@
+/***************************************************************************************************/
+/*
+   Virtual time of LiquidCrystal_I2C host tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - replaces "extras/linux/Clock.cpp", time moves only by "delay()",
+     "delayMicroseconds()", "micros()" & I2C transfers, so every run gives
+     the same results
+   - "micros()" moves time by 1usec, so polling loops always end
+   - "millis()" & "micros()" wrap at 32-bit, same as "../../linux/Clock.cpp"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef VirtualClock_h
+#define VirtualClock_h
+
+#include <stdint.h>
+
+extern uint64_t hostTime;               //in nsec
+
+#endif
@@ -0,0 +1,117 @@
+/***************************************************************************************************/
+/*
+   Host stand-in of Arduino "Wire" for LiquidCrystal_I2C tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - see "Wire.h" for details
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <Wire.h>
+
+TwoWire Wire;
+
+
+void TwoWire::attach(uint8_t address, I2CSlave *device)
+{
+  _device[address & 0x7F] = device;
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+  _txAddress  = address;
+  _txLength   = 0;
+  _txOverflow = false;
+}
+
+size_t TwoWire::write(uint8_t value)
+{
+  if (_txLength >= BUFFER_LENGTH) {_txOverflow = true; return 0;}
+
+  _txBuffer[_txLength++] = value;
+
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t length)
+{
+  size_t written = 0;
+
+  while ((length--) && (write(*data++) == 1)) {written++;}
+
+  return written;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+  _stats.transactions++;
+
+  _clocks(1 + 9);                                       //START & address
+
+  if (_txOverflow == true)                              {return 1;}
+  I2CSlave *device = _device[_txAddress & 0x7F];
+
+  if ((device == NULL) || (_speed > _maxSpeed))         {_clocks(1); return 2;}
+
+  for (uint8_t i = 0; i < _txLength; i++)
+  {
+    _clocks(9);                                         //PCF8574 outputs change on ACK
+
+    device->onWrite(_txBuffer[i], hostTime);
+  }
+
+  _stats.bytes += _txLength;
+
+  _clocks(1);                                           //STOP
+
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity, uint8_t)
+{
+  _stats.transactions++;
+
+  _clocks(1 + 9);
+
+  _rxValue = -1;
+
+  I2CSlave *device = _device[address & 0x7F];
+
+  if ((device == NULL) || (quantity == 0) || (_speed > _maxSpeed)) {_clocks(1); return 0;}
+
+  _rxValue = device->onRead(hostTime);                 //PCF8574 samples inputs on address ACK
+
+  _clocks((9 * quantity) + 1);
+
+  _stats.bytes += quantity;
+
+  return quantity;
+}
+
+int TwoWire::available()
+{
+  return (_rxValue >= 0) ? 1 : 0;
+}
+
+int TwoWire::read()
+{
+  int value = _rxValue;
+
+  _rxValue = -1;
+
+  return value;
+}
+
+void TwoWire::_clocks(uint32_t clocks)
+{
+  _stats.clocks += clocks;
+
+  hostTime += ((uint64_t)clocks * 1000000000ULL) / _speed;
+}
@@ -0,0 +1,77 @@
+/***************************************************************************************************/
+/*
+   Host stand-in of Arduino "Wire" for LiquidCrystal_I2C tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - slave is "I2CSlave" object attached to address, see "../emulator",
+     every 7-bit address may have its own slave
+   - every transfer moves virtual time by its bus clocks, START, address,
+     9 clocks per byte & STOP
+   - transactions, bytes & clocks are counted for benchmarks
+   - "setMaxClock()" models long wires, faster transfers are NACKed
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef Wire_h
+#define Wire_h
+
+#include <Arduino.h>
+#include <I2CSlave.h>
+
+#include "VirtualClock.h"
+
+#define BUFFER_LENGTH 32                //AVR "Wire" txBuffer size, see LCD_I2C_BUFFER_LENGTH
+
+
+typedef struct
+{
+  uint32_t transactions;                //write & read transactions
+  uint32_t bytes;                       //data bytes written & read, address excluded
+  uint64_t clocks;                      //SCL clocks of all transfers
+}
+twoWireStats;
+
+
+class TwoWire
+{
+  public:
+   void    begin()                      {}
+   void    setClock(uint32_t speed)     {_speed = speed;}
+   void    beginTransmission(uint8_t address);
+   size_t  write(uint8_t value);
+   size_t  write(const uint8_t *data, size_t length);
+   uint8_t endTransmission(bool stop = true);
+   uint8_t requestFrom(uint8_t address, uint8_t quantity, uint8_t stop = true);
+   int     available();
+   int     read();
+
+   void         attach(uint8_t address, I2CSlave *device);
+   void         setMaxClock(uint32_t speed) {_maxSpeed = speed;}
+   uint32_t     getClock()              {return _speed;}
+   twoWireStats getStats()              {return _stats;}
+   void         resetStats()            {memset(&_stats, 0, sizeof(_stats));}
+
+  private:
+   I2CSlave      *_device[128] = {};
+   uint32_t       _speed       = 100000;
+   uint32_t       _maxSpeed    = 0xFFFFFFFF;
+   uint8_t        _txAddress   = 0;
+   uint8_t        _txBuffer[BUFFER_LENGTH];
+   uint8_t        _txLength    = 0;
+   bool           _txOverflow  = false;
+   int16_t        _rxValue     = -1;
+   twoWireStats   _stats       = {};
+
+   void _clocks(uint32_t clocks);
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,2 @@
+/* PROGMEM helpers are defined by host "Arduino.h" */
+#include <Arduino.h>
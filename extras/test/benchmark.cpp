@@ -0,0 +1,195 @@
+/***************************************************************************************************/
+/*
+   Reproducible I2C bus benchmark of LiquidCrystal_I2C
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - every operation runs on host "Wire" with HD44780 emulator at 100kHz,
+     400kHz & 1MHz, traffic & virtual time are the same on every run
+   - bus time is SCL clocks of all transfers, total time adds command
+     waits & "begin()" power-on delay
+   - "make benchmark" compares results with "benchmark_baseline.txt" &
+     exits with 1 if any value grew, "make baseline" saves new results
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <LiquidCrystal_I2C.h>
+
+#include "emulator/LcdEmulator.h"
+
+#define COLUMNS        20               //LCD columns
+#define ROWS           4                //LCD rows
+#define BENCHMARK_RUNS 10               //iterations per operation, "begin()" runs once
+#define SPEEDS         3
+#define OPERATIONS     8
+
+typedef struct
+{
+  double   transactions;
+  double   bytes;
+  double   busTime;                     //SCL clocks, in usec
+  double   totalTime;                   //in usec
+}
+benchmarkResult;
+
+static const uint32_t   busSpeed[SPEEDS] = {100000, 400000, 1000000};
+static const char      *text80           = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789!@#$%^&*()_+-=[]{}";
+static const uint8_t    glyph[8]         = {0x04, 0x0E, 0x0E, 0x0E, 0x1F, 0x00, 0x04, 0x00};
+static LiquidCrystal_I2C lcd(PCF8574_ADDR_A21_A11_A01);
+static uint32_t         speed;
+
+
+static void benchBegin(uint8_t)         {lcd.begin(COLUMNS, ROWS, LCD_5x8DOTS, speed);}
+static void benchWrite(uint8_t)         {lcd.write('A');}
+static void benchPrint20(uint8_t)       {lcd.setCursor(0, 0); lcd.print(text80 + 60);}
+static void benchPrint80(uint8_t)       {lcd.setCursor(0, 0); lcd.print(text80);}
+static void benchSetCursor(uint8_t run) {lcd.setCursor(run % COLUMNS, run % ROWS);}
+static void benchCreateChar(uint8_t)    {lcd.createChar(0, glyph);}
+static void benchClear(uint8_t)         {lcd.clear();}
+static void benchGraph(uint8_t run)     {lcd.printHorizontalGraph('L', 0, 100 * run, 1023);}
+
+typedef void (*benchmarkFunction)(uint8_t run);
+
+static const benchmarkFunction benchmark[OPERATIONS] = {benchBegin, benchWrite, benchPrint20, benchPrint80, benchSetCursor, benchCreateChar, benchClear, benchGraph};
+static const char * const      name[OPERATIONS]      = {"begin", "write", "print20", "print80", "setCursor", "createChar", "clear", "printHorizontalGraph"};
+
+
+static benchmarkResult measure(uint8_t operation)
+{
+  uint8_t  runs      = (operation == 0) ? 1 : BENCHMARK_RUNS;
+  uint64_t startTime = hostTime;
+
+  Wire.resetStats();
+
+  for (uint8_t run = 0; run < runs; run++) {benchmark[operation](run);}
+
+  twoWireStats    stats  = Wire.getStats();
+  benchmarkResult result;
+
+  result.transactions = (double)stats.transactions / runs;
+  result.bytes        = (double)stats.bytes / runs;
+  result.busTime      = ((double)stats.clocks * 1000000 / speed) / runs;
+  result.totalTime    = ((double)(hostTime - startTime) / 1000) / runs;
+
+  return result;
+}
+
+
+static bool loadBaseline(const char *path, benchmarkResult baseline[SPEEDS][OPERATIONS])
+{
+  FILE *file = fopen(path, "r");
+  char  line[128];
+
+  if (file == NULL) {return false;}
+
+  memset(baseline, 0, sizeof(benchmarkResult) * SPEEDS * OPERATIONS);
+
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    unsigned long   lineSpeed;
+    char            lineName[32];
+    benchmarkResult value;
+
+    if (line[0] == '#') {continue;}
+
+    if (sscanf(line, "%lu %31s %lf %lf %lf %lf", &lineSpeed, lineName, &value.transactions, &value.bytes, &value.busTime, &value.totalTime) != 6) {continue;}
+
+    for (uint8_t i = 0; i < SPEEDS; i++)
+    {
+      for (uint8_t j = 0; j < OPERATIONS; j++)
+      {
+        if ((busSpeed[i] == lineSpeed) && (strcmp(name[j], lineName) == 0)) {baseline[i][j] = value;}
+      }
+    }
+  }
+
+  fclose(file);
+
+  return true;
+}
+
+
+static void saveBaseline(const char *path, benchmarkResult result[SPEEDS][OPERATIONS])
+{
+  FILE *file = fopen(path, "w");
+
+  if (file == NULL) {return;}
+
+  fprintf(file, "# LiquidCrystal_I2C host benchmark baseline, %ux%u LCD, \"make baseline\" updates this file\n", COLUMNS, ROWS);
+  fprintf(file, "# speed, operation, I2C transactions, bytes, bus usec, total usec, per operation\n");
+
+  for (uint8_t i = 0; i < SPEEDS; i++)
+  {
+    for (uint8_t j = 0; j < OPERATIONS; j++)
+    {
+      fprintf(file, "%lu %s %.1f %.1f %.1f %.1f\n", (unsigned long)busSpeed[i], name[j], result[i][j].transactions, result[i][j].bytes, result[i][j].busTime, result[i][j].totalTime);
+    }
+  }
+
+  fclose(file);
+}
+
+
+/* usage: benchmark <baseline file> [--save] */
+int main(int argc, char **argv)
+{
+  static benchmarkResult result[SPEEDS][OPERATIONS];
+  static benchmarkResult baseline[SPEEDS][OPERATIONS];
+  bool                   save        = (argc > 2) && (strcmp(argv[2], "--save") == 0);
+  bool                   compare     = (argc > 1) && (save == false) && (loadBaseline(argv[1], baseline) == true);
+  uint16_t               regressions = 0;
+
+  for (uint8_t i = 0; i < SPEEDS; i++)
+  {
+    LcdEmulator emulator;
+
+    Wire.attach(PCF8574_ADDR_A21_A11_A01, &emulator);
+
+    speed = busSpeed[i];
+
+    printf("I2C speed, Hz: %lu\n", (unsigned long)speed);
+
+    for (uint8_t j = 0; j < OPERATIONS; j++)
+    {
+      result[i][j] = measure(j);
+
+      printf("  %-22s transactions: %5.1f, bytes: %6.1f, bus usec: %9.1f, total usec: %9.1f", name[j], result[i][j].transactions, result[i][j].bytes, result[i][j].busTime, result[i][j].totalTime);
+
+      if (compare == true)
+      {
+        const benchmarkResult &limit = baseline[i][j];
+
+        if ((result[i][j].transactions > limit.transactions + 0.05) || (result[i][j].bytes > limit.bytes + 0.05) ||
+            (result[i][j].busTime > limit.busTime + 0.05) || (result[i][j].totalTime > limit.totalTime + 0.05))
+        {
+          printf(" REGRESSION, baseline: %.1f, %.1f, %.1f, %.1f", limit.transactions, limit.bytes, limit.busTime, limit.totalTime);
+
+          regressions++;
+        }
+      }
+
+      printf("\n");
+    }
+
+    if (emulator.violations != 0) {printf("  %u writes while LCD busy\n", emulator.violations); regressions++;}
+
+    Wire.attach(PCF8574_ADDR_A21_A11_A01, NULL);
+  }
+
+  if (save == true) {saveBaseline(argv[1], result); printf("baseline saved to %s\n", argv[1]);}
+
+  if ((argc > 1) && (save == false) && (compare == false)) {printf("no baseline %s\n", argv[1]); return 1;}
+
+  printf("%u regressions\n", regressions);
+
+  return (regressions == 0) ? 0 : 1;
+}
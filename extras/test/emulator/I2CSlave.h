@@ -0,0 +1,33 @@
+/***************************************************************************************************/
+/*
+   I2C slave interface of LiquidCrystal_I2C test harness
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - bus stand-ins, host "Wire" & fake "/dev/i2c-N", pass every ACKed
+     byte with its time, in nsec
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef I2CSlave_h
+#define I2CSlave_h
+
+#include <stdint.h>
+
+
+class I2CSlave
+{
+  public:
+   virtual ~I2CSlave() {}
+
+   virtual void    onWrite(uint8_t value, uint64_t time) = 0; //byte ACKed, PCF8574 outputs change
+   virtual uint8_t onRead(uint64_t time) = 0;                 //PCF8574 inputs sampled
+};
+
+#endif
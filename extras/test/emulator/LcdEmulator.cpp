@@ -0,0 +1,272 @@
+/***************************************************************************************************/
+/*
+   PCF8574 & HD44780 emulator of LiquidCrystal_I2C test harness
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - see p.24..p.29 of HD44780 datasheet for instructions
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <string.h>
+
+#include "LcdEmulator.h"
+
+
+/* LCD pins numbers, same as "LiquidCrystal_I2C()" constructor */
+LcdEmulator::LcdEmulator(uint8_t P0, uint8_t P1, uint8_t P2, uint8_t P3, uint8_t P4, uint8_t P5, uint8_t P6, uint8_t P7)
+{
+  uint8_t pins[8] = {P0, P1, P2, P3, P4, P5, P6, P7};
+
+  _rsMask = _rwMask = _enMask = _blMask = 0;
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    switch (pins[i])
+    {
+      case 4:  _rsMask    = 0x01 << i; break;
+      case 5:  _rwMask    = 0x01 << i; break;
+      case 6:  _enMask    = 0x01 << i; break;
+      case 16: _blMask    = 0x01 << i; break;
+      case 11: _dbPort[0] = i;         break;
+      case 12: _dbPort[1] = i;         break;
+      case 13: _dbPort[2] = i;         break;
+      case 14: _dbPort[3] = i;         break;
+    }
+  }
+
+  _port           = 0xFF;               //PCF8574 power-on state
+  _fourBit        = false;              //HD44780 power-on state
+  _writeLow       = false;
+  _highNibble     = 0;
+  _readLow        = false;
+  _readValue      = 0;
+  _busyUntil      = 0;
+
+  memset(_ddram, ' ', sizeof(_ddram));
+  memset(_cgram, 0,   sizeof(_cgram));
+
+  _addressCounter = 0;
+  _cgramSelected  = false;
+  _entryMode      = 0x02;               //I/D=1, S=0
+  _displayControl = 0x00;
+  _functionSet    = 0x10;               //DL=1
+  _displayShift   = 0;
+
+  commands         = 0;
+  characters       = 0;
+  violations       = 0;
+  invalidAddresses = 0;
+}
+
+
+void LcdEmulator::onWrite(uint8_t value, uint64_t time)
+{
+  uint8_t previous = _port;
+
+  _port = value;
+
+  bool rs = (previous & _rsMask) != 0;
+  bool rw = (previous & _rwMask) != 0;
+
+  /* E rising edge of read, LCD puts nibble on DB7..DB4 */
+  if (((previous & _enMask) == 0) && ((value & _enMask) != 0) && ((value & _rwMask) != 0))
+  {
+    if ((_fourBit == false) || (_readLow == false)) {_readValue = _readRegister((value & _rsMask) != 0, time);}
+
+    return;
+  }
+
+  /* E falling edge, RS, RW & DB7..DB4 are latched */
+  if (((previous & _enMask) == 0) || ((value & _enMask) != 0)) {return;}
+
+  if (rw == true)
+  {
+    if (_fourBit == true) {_readLow = !_readLow;}
+
+    if ((rs == true) && ((_fourBit == false) || (_readLow == false))) {_moveAddress((_entryMode & 0x02) != 0);} //data read moves address counter
+
+    return;
+  }
+
+  if (_fourBit == false) {_execute(rs, _nibble(previous) << 4, time); return;}
+
+  if (_writeLow == false)
+  {
+    _highNibble = _nibble(previous);
+    _writeLow   = true;
+
+    return;
+  }
+
+  _writeLow = false;
+
+  _execute(rs, (_highNibble << 4) | _nibble(previous), time);
+}
+
+
+uint8_t LcdEmulator::onRead(uint64_t)
+{
+  uint8_t value = _port;                //quasi-bidirectional, low outputs read low
+
+  if (((_port & _enMask) != 0) && ((_port & _rwMask) != 0))
+  {
+    uint8_t nibble = ((_fourBit == true) && (_readLow == true)) ? (_readValue & 0x0F) : (_readValue >> 4);
+
+    value &= ~_ports(0x0F) | _ports(nibble);
+  }
+
+  return value;
+}
+
+
+std::string LcdEmulator::text(uint8_t column, uint8_t row, uint8_t length, uint8_t columns)
+{
+  uint8_t     rowAddress[4] = {0x00, 0x40, columns, (uint8_t)(0x40 + columns)};
+  std::string result;
+
+  for (uint8_t i = 0; i < length; i++) {result += (char)_ddram[(rowAddress[row & 0x03] + column + i) & 0x7F];}
+
+  return result;
+}
+
+
+uint8_t LcdEmulator::_nibble(uint8_t port)
+{
+  uint8_t nibble = 0;
+
+  for (uint8_t i = 0; i < 4; i++) {nibble |= ((port >> _dbPort[i]) & 0x01) << i;}
+
+  return nibble;
+}
+
+
+uint8_t LcdEmulator::_ports(uint8_t nibble)
+{
+  uint8_t port = 0;
+
+  for (uint8_t i = 0; i < 4; i++) {port |= ((nibble >> i) & 0x01) << _dbPort[i];}
+
+  return port;
+}
+
+
+void LcdEmulator::_execute(bool rs, uint8_t value, uint64_t time)
+{
+  uint64_t duration = LCD_EMULATOR_COMMAND_TIME;
+
+  if (time < _busyUntil) {violations++;}
+
+  if (rs == true)
+  {
+    characters++;
+
+    if (_cgramSelected == true) {_cgram[_addressCounter & 0x3F] = value;}
+    else                        {_ddram[_addressCounter & 0x7F] = value;}
+
+    _moveAddress((_entryMode & 0x02) != 0);
+
+    if ((_cgramSelected == false) && ((_entryMode & 0x01) != 0)) {_displayShift += ((_entryMode & 0x02) != 0) ? -1 : 1;}
+  }
+  else
+  {
+    commands++;
+
+    if ((value & 0x80) != 0)                                       //set DDRAM address
+    {
+      _addressCounter = value & 0x7F;
+      _cgramSelected  = false;
+
+      bool valid = ((_functionSet & 0x08) != 0) ? ((_addressCounter <= 0x27) || ((_addressCounter >= 0x40) && (_addressCounter <= 0x67))) : (_addressCounter <= 0x4F);
+
+      if (valid == false) {invalidAddresses++;}
+    }
+    else if ((value & 0x40) != 0)                                  //set CGRAM address
+    {
+      _addressCounter = value & 0x3F;
+      _cgramSelected  = true;
+    }
+    else if ((value & 0x20) != 0)                                  //function set
+    {
+      _functionSet = value & 0x1C;
+      _fourBit     = (value & 0x10) == 0;
+      _writeLow    = false;
+      _readLow     = false;
+    }
+    else if ((value & 0x10) != 0)                                  //cursor or display shift
+    {
+      if ((value & 0x08) != 0) {_displayShift += ((value & 0x04) != 0) ? 1 : -1;}
+      else                     {_moveAddress((value & 0x04) != 0);}
+    }
+    else if ((value & 0x08) != 0) {_displayControl = value & 0x07;} //display control
+    else if ((value & 0x04) != 0) {_entryMode      = value & 0x03;} //entry mode set
+    else if ((value & 0x02) != 0)                                  //return home
+    {
+      _addressCounter = 0;
+      _cgramSelected  = false;
+      _displayShift   = 0;
+      duration        = LCD_EMULATOR_CLEAR_TIME;
+    }
+    else if ((value & 0x01) != 0)                                  //clear display, I/D=1
+    {
+      memset(_ddram, ' ', sizeof(_ddram));
+
+      _addressCounter = 0;
+      _cgramSelected  = false;
+      _displayShift   = 0;
+      _entryMode     |= 0x02;
+      duration        = LCD_EMULATOR_CLEAR_TIME;
+    }
+  }
+
+  _busyUntil = time + duration;
+}
+
+
+void LcdEmulator::_moveAddress(bool increment)
+{
+  if (_cgramSelected == true)
+  {
+    _addressCounter = (_addressCounter + (increment ? 1 : -1)) & 0x3F;
+
+    return;
+  }
+
+  if ((_functionSet & 0x08) != 0)                                  //2-line, 0x00..0x27 & 0x40..0x67
+  {
+    if (increment == true)
+    {
+      _addressCounter++;
+
+      if      (_addressCounter == 0x28) {_addressCounter = 0x40;}
+      else if (_addressCounter == 0x68) {_addressCounter = 0x00;}
+    }
+    else
+    {
+      if      (_addressCounter == 0x00) {_addressCounter = 0x67;}
+      else if (_addressCounter == 0x40) {_addressCounter = 0x27;}
+      else                              {_addressCounter--;}
+    }
+  }
+  else                                                             //1-line, 0x00..0x4F
+  {
+    if (increment == true) {_addressCounter = (_addressCounter == 0x4F) ? 0x00 : _addressCounter + 1;}
+    else                   {_addressCounter = (_addressCounter == 0x00) ? 0x4F : _addressCounter - 1;}
+  }
+}
+
+
+uint8_t LcdEmulator::_readRegister(bool rs, uint64_t time)
+{
+  if (rs == false) {return ((time < _busyUntil) ? 0x80 : 0x00) | _addressCounter;}
+
+  if (time < _busyUntil) {violations++;}
+
+  return (_cgramSelected == true) ? _cgram[_addressCounter & 0x3F] : _ddram[_addressCounter & 0x7F];
+}
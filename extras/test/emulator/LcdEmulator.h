@@ -0,0 +1,90 @@
+/***************************************************************************************************/
+/*
+   PCF8574 & HD44780 emulator of LiquidCrystal_I2C test harness
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - decodes PCF8574 port writes into HD44780 state, DDRAM, CGRAM,
+     address counter, entry mode, display control & display shift
+   - 8-bit mode after power-on, 4-bit mode after function set DL=0,
+     data & instructions are latched on E falling edge
+   - reads return busy flag, address counter or RAM on DB7..DB4, when
+     E=1 & RW=1
+   - instructions written while busy are executed & counted in "violations"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LcdEmulator_h
+#define LcdEmulator_h
+
+#include <string>
+
+#include "I2CSlave.h"
+
+#define LCD_EMULATOR_COMMAND_TIME 37000   //command duration, in nsec
+#define LCD_EMULATOR_CLEAR_TIME   1520000 //"clear()" & "home()" duration, in nsec
+
+
+class LcdEmulator : public I2CSlave
+{
+  public:
+   LcdEmulator(uint8_t P0 = 4, uint8_t P1 = 5, uint8_t P2 = 6, uint8_t P3 = 16, uint8_t P4 = 11, uint8_t P5 = 12, uint8_t P6 = 13, uint8_t P7 = 14);
+
+   void    onWrite(uint8_t value, uint64_t time);
+   uint8_t onRead(uint64_t time);
+
+   std::string text(uint8_t column, uint8_t row, uint8_t length, uint8_t columns = 16); //DDRAM with "LiquidCrystal_I2C" row addresses
+   uint8_t     ddram(uint8_t address)   {return _ddram[address & 0x7F];}
+   uint8_t     cgram(uint8_t address)   {return _cgram[address & 0x3F];}
+   uint8_t     addressCounter()         {return _addressCounter;}
+   bool        isCgram()                {return _cgramSelected;}
+   bool        isFourBit()              {return _fourBit;}
+   uint8_t     entryMode()              {return _entryMode;}
+   uint8_t     displayControl()         {return _displayControl;}
+   uint8_t     functionSet()            {return _functionSet;}
+   int8_t      displayShift()           {return _displayShift;}
+   bool        backlight()              {return (_port & _blMask) != 0;}
+
+   uint32_t    commands;                //executed instructions
+   uint32_t    characters;              //written DDRAM & CGRAM data
+   uint32_t    violations;              //instructions & data written while busy
+   uint32_t    invalidAddresses;        //DDRAM addresses outside of 1-line or 2-line ranges
+
+  private:
+   uint8_t  _rsMask;
+   uint8_t  _rwMask;
+   uint8_t  _enMask;
+   uint8_t  _blMask;
+   uint8_t  _dbPort[4];                 //DB4..DB7 PCF8574 ports
+
+   uint8_t  _port;
+   bool     _fourBit;
+   bool     _writeLow;                  //true=next written nibble is DB3..DB0
+   uint8_t  _highNibble;
+   bool     _readLow;                   //true=next read nibble is DB3..DB0
+   uint8_t  _readValue;
+   uint64_t _busyUntil;
+
+   uint8_t  _ddram[128];
+   uint8_t  _cgram[64];
+   uint8_t  _addressCounter;
+   bool     _cgramSelected;
+   uint8_t  _entryMode;
+   uint8_t  _displayControl;
+   uint8_t  _functionSet;
+   int8_t   _displayShift;
+
+   uint8_t _nibble(uint8_t port);
+   uint8_t _ports(uint8_t nibble);
+   void    _execute(bool rs, uint8_t value, uint64_t time);
+   void    _moveAddress(bool increment);
+   uint8_t _readRegister(bool rs, uint64_t time);
+};
+
+#endif
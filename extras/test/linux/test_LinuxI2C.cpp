@@ -0,0 +1,230 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_LinuxI2C tests, native build without Arduino core
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - linked with "-Wl,--wrap=ioctl", ioctl() calls on fake descriptor go to
+     HD44780 emulator, I2C_RDWR & SMBus transfers take bus clocks of
+     virtual time, see "../arduino/VirtualClock.h"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <errno.h>
+#include <stdarg.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "../test.h"
+#include "../arduino/VirtualClock.h"
+
+#include <LiquidCrystal_I2C_LinuxI2C.h>
+
+#if defined (ARDUINO)
+#error native test, build with "make linux"
+#endif
+
+#define FAKE_FD    1000
+#define FAKE_SPEED 400000
+
+
+static LcdEmulator  *fakeEmulator  = NULL;
+static unsigned long fakeFunctions = 0;
+static uint16_t      fakeSlave     = 0;
+static uint32_t      fakeTransfers = 0;                 //I2C_RDWR & I2C_SMBUS calls
+static bool          fakeZeroLength = true;             //false=adapter with "I2C_AQ_NO_ZERO_LEN" quirk
+
+static void fakeClocks(uint32_t clocks)
+{
+  hostTime += ((uint64_t)clocks * 1000000000ULL) / FAKE_SPEED;
+}
+
+static int fakeTransfer(uint16_t address, bool read, uint8_t *data, uint16_t length)
+{
+  fakeTransfers++;
+
+  fakeClocks(1 + 9);                                    //START & address
+
+  if ((fakeEmulator == NULL) || (address != PCF8574_ADDR_A21_A11_A01)) {errno = ENXIO; return -1;}
+
+  for (uint16_t i = 0; i < length; i++)
+  {
+    if (read == true) {data[i] = fakeEmulator->onRead(hostTime);}
+
+    fakeClocks(9);
+
+    if (read == false) {fakeEmulator->onWrite(data[i], hostTime);}
+  }
+
+  fakeClocks(1);                                        //STOP
+
+  return 0;
+}
+
+
+extern "C" int __real_ioctl(int fd, unsigned long request, ...);
+
+extern "C" int __wrap_ioctl(int fd, unsigned long request, ...)
+{
+  va_list arguments;
+
+  va_start(arguments, request);
+
+  void *argument = va_arg(arguments, void *);
+
+  va_end(arguments);
+
+  if (fd != FAKE_FD) {return __real_ioctl(fd, request, argument);}
+
+  switch (request)
+  {
+    case I2C_FUNCS:
+      *(unsigned long *)argument = fakeFunctions;
+      return 0;
+
+    case I2C_SLAVE:
+      fakeSlave = (uint16_t)(uintptr_t)argument;
+      return 0;
+
+    case I2C_RDWR:
+    {
+      struct i2c_rdwr_ioctl_data *transfer = (struct i2c_rdwr_ioctl_data *)argument;
+
+      if ((fakeFunctions & I2C_FUNC_I2C) == 0) {errno = EOPNOTSUPP; return -1;}
+
+      for (uint32_t i = 0; i < transfer->nmsgs; i++)
+      {
+        struct i2c_msg &message = transfer->msgs[i];
+
+        if ((message.len == 0) && (fakeZeroLength == false)) {errno = EOPNOTSUPP; return -1;}
+
+        if (fakeTransfer(message.addr, (message.flags & I2C_M_RD) != 0, message.buf, message.len) != 0) {return -1;}
+      }
+
+      return transfer->nmsgs;
+    }
+
+    case I2C_SMBUS:
+    {
+      struct i2c_smbus_ioctl_data *access = (struct i2c_smbus_ioctl_data *)argument;
+
+      if (access->size != I2C_SMBUS_BYTE) {errno = EOPNOTSUPP; return -1;}
+
+      if (access->read_write == I2C_SMBUS_READ) {return fakeTransfer(fakeSlave, true, &access->data->byte, 1);}
+
+      uint8_t value = access->command;                  //"send byte" value
+
+      return fakeTransfer(fakeSlave, false, &value, 1);
+    }
+  }
+
+  errno = ENOTTY;
+
+  return -1;
+}
+
+
+class fakeAdapter
+{
+  public:
+   fakeAdapter(unsigned long functions, bool zeroLength = true) {fakeEmulator = &emulator; fakeFunctions = functions; fakeTransfers = 0; fakeZeroLength = zeroLength;}
+  ~fakeAdapter()                                                {fakeEmulator = NULL;}
+
+   LcdEmulator emulator;
+};
+
+
+TEST(linuxI2CBurstPerIoctl)
+{
+  fakeAdapter                adapter(I2C_FUNC_I2C | I2C_FUNC_SMBUS_BYTE);
+  LiquidCrystal_I2C_LinuxI2C bus(FAKE_FD);
+  LiquidCrystal_I2C          lcd(bus, PCF8574_ADDR_A21_A11_A01, 4, 5, 6, 16, 11, 12, 13, 14, POSITIVE);
+
+  CHECK(lcd.begin(16, 2, LCD_5x8DOTS, FAKE_SPEED) == true);
+
+  lcd.setCursor(2, 1);
+
+  fakeTransfers = 0;
+
+  lcd.print("Hello Linux!");                        //48 bytes, one I2C_RDWR message
+
+  CHECK(fakeTransfers == 1);
+  CHECK_TEXT("  Hello Linux!  ", adapter.emulator.text(0, 1, 16));
+  CHECK(adapter.emulator.violations == 0);
+}
+
+
+TEST(linuxI2CNoZeroLengthAdapter)
+{
+  fakeAdapter                adapter(I2C_FUNC_I2C, false); //zero length messages are rejected
+  LiquidCrystal_I2C_LinuxI2C bus(FAKE_FD);
+  LiquidCrystal_I2C          lcd(bus);
+
+  CHECK(lcd.begin(16, 2, LCD_5x8DOTS, FAKE_SPEED) == true); //presence check is 1-byte read
+
+  lcd.print("Probe");
+
+  CHECK_TEXT("Probe", adapter.emulator.text(0, 0, 5));
+}
+
+
+TEST(linuxI2CReadsBusyFlag)
+{
+  fakeAdapter                adapter(I2C_FUNC_I2C);
+  LiquidCrystal_I2C_LinuxI2C bus(FAKE_FD);
+  LiquidCrystal_I2C          lcd(bus);
+
+  CHECK(lcd.begin(16, 2, LCD_5x8DOTS, FAKE_SPEED) == true);
+  CHECK(lcd.setPacing(LCD_PACING_BUSY_FLAG) == true);
+
+  lcd.clear();
+  lcd.print("BF");
+
+  CHECK_TEXT("BF", adapter.emulator.text(0, 0, 2));
+  CHECK(lcd.getStats().busyFlagPolls > 0);
+  CHECK(adapter.emulator.violations == 0);
+}
+
+
+TEST(linuxI2CSmbusFallback)
+{
+  fakeAdapter                adapter(I2C_FUNC_SMBUS_BYTE);
+  LiquidCrystal_I2C_LinuxI2C bus(FAKE_FD);
+  LiquidCrystal_I2C          lcd(bus);
+
+  CHECK(lcd.begin(16, 2, LCD_5x8DOTS, FAKE_SPEED) == true);
+
+  fakeTransfers = 0;
+
+  lcd.print("SMBus");                               //one "send byte" per PCF8574 byte
+
+  CHECK(fakeTransfers == 5 * 4);
+  CHECK_TEXT("SMBus", adapter.emulator.text(0, 0, 5));
+  CHECK(adapter.emulator.violations == 0);
+}
+
+
+TEST(linuxI2CRejectsAdapter)
+{
+  fakeAdapter                adapter(0);            //no plain I2C & no SMBus byte
+  LiquidCrystal_I2C_LinuxI2C bus(FAKE_FD);
+  LiquidCrystal_I2C          lcd(bus);
+
+  CHECK(lcd.begin(16, 2) == false);
+}
+
+
+TEST(linuxI2CNoDevice)
+{
+  LiquidCrystal_I2C_LinuxI2C bus("/dev/i2c-does-not-exist");
+  LiquidCrystal_I2C          lcd(bus);
+
+  CHECK(lcd.begin(16, 2) == false);
+}
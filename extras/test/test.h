@@ -0,0 +1,106 @@
+/***************************************************************************************************/
+/*
+   Test cases & checks of LiquidCrystal_I2C test harness
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - "TEST(name)" registers test case, "main()" in "test_main.cpp" runs
+     all of them & returns number of failed cases
+   - failed "CHECK()" prints file, line & expression then leaves the case
+   - "testDisplay" is 16x2 LCD, PCF8574 with default pins at 0x27 & emulator
+     attached to host "Wire", not available in native Linux build
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef test_h
+#define test_h
+
+#include <string>
+
+#include <Arduino.h>
+
+#include <LiquidCrystal_I2C.h>
+
+#include "emulator/LcdEmulator.h"
+
+
+typedef void (*testFunction)(bool &failed);
+
+class testCase
+{
+  public:
+   testCase(const char *name, testFunction function);
+
+   const char   *name;
+   testFunction  function;
+   testCase     *next;
+
+   static testCase *first;
+};
+
+#define TEST(name)                                             \
+  static void name(bool &failed);                              \
+  static testCase name##Case(#name, name);                     \
+  static void name(bool &failed)
+
+#define CHECK(condition)                                       \
+  do                                                           \
+  {                                                            \
+    if (!(condition))                                          \
+    {                                                          \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      failed = true;                                           \
+      return;                                                  \
+    }                                                          \
+  } while (0)
+
+#define CHECK_TEXT(expected, actual)                           \
+  do                                                           \
+  {                                                            \
+    std::string value = (actual);                              \
+    if (value != (expected))                                   \
+    {                                                          \
+      printf("%s:%d: expected \"%s\", got \"%s\"\n", __FILE__, __LINE__, (expected), value.c_str()); \
+      failed = true;                                           \
+      return;                                                  \
+    }                                                          \
+  } while (0)
+
+
+#if defined (ARDUINO)
+#include <Wire.h>
+
+class testDisplay
+{
+  public:
+   testDisplay(uint8_t columns = 16, uint8_t rows = 2) : lcd(PCF8574_ADDR_A21_A11_A01), _columns(columns), _rows(rows)
+   {
+     Wire.attach(PCF8574_ADDR_A21_A11_A01, &emulator);
+     Wire.setClock(LCD_I2C_SPEED);
+   }
+
+  ~testDisplay()
+   {
+     Wire.attach(PCF8574_ADDR_A21_A11_A01, NULL);
+     Wire.setMaxClock(0xFFFFFFFF);
+   }
+
+   bool        begin(uint32_t speed = LCD_I2C_SPEED)      {return lcd.begin(_columns, _rows, LCD_5x8DOTS, speed);}
+   std::string text(uint8_t column, uint8_t row, uint8_t length) {return emulator.text(column, row, length, _columns);}
+
+   LcdEmulator       emulator;
+   LiquidCrystal_I2C lcd;
+
+  private:
+   uint8_t _columns;
+   uint8_t _rows;
+};
+#endif
+
+#endif
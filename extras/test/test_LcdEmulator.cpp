@@ -0,0 +1,73 @@
+/***************************************************************************************************/
+/*
+   HD44780 emulator self-tests, checks used by other tests must fail when they should
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#define EN 0x04                                     //default pins, P2=E
+#define RS 0x01                                     //P0=RS
+
+
+static void pulse(LcdEmulator &emulator, uint8_t port, uint64_t time)
+{
+  emulator.onWrite(port | EN, time);
+  emulator.onWrite(port,      time);
+}
+
+static void send(LcdEmulator &emulator, uint8_t mode, uint8_t value, uint64_t time)
+{
+  pulse(emulator, mode | (value & 0xF0),        time);  //DB7..DB4 on P7..P4
+  pulse(emulator, mode | ((value << 4) & 0xF0), time);
+}
+
+
+TEST(emulatorCountsViolations)
+{
+  LcdEmulator emulator;
+  uint64_t    time = 0;
+
+  pulse(emulator, 0x20, time);                      //4-bit mode
+
+  time += 100000;
+
+  send(emulator, 0x00, 0x28, time);                 //function set
+  send(emulator, 0x00, 0x80, time + 10000);         //10usec later, still busy
+
+  CHECK(emulator.isFourBit() == true);
+  CHECK(emulator.violations == 1);
+
+  send(emulator, RS, 'A', time + 100000);
+
+  CHECK(emulator.violations == 1);
+  CHECK(emulator.ddram(0x00) == 'A');
+  CHECK(emulator.addressCounter() == 0x01);
+}
+
+
+TEST(emulatorWrapsTwoLineAddress)
+{
+  LcdEmulator emulator;
+  uint64_t    time = 0;
+
+  pulse(emulator, 0x20, time);
+
+  send(emulator, 0x00, 0x28,        time += 100000);
+  send(emulator, 0x00, 0x80 | 0x27, time += 100000);
+  send(emulator, RS,   'A',         time += 100000);
+
+  CHECK(emulator.addressCounter() == 0x40);
+
+  send(emulator, 0x00, 0x80 | 0x2A, time += 100000);
+
+  CHECK(emulator.invalidAddresses == 1);
+  CHECK(emulator.violations == 0);
+}
@@ -0,0 +1,570 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C core tests
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <vector>
+
+#include "test.h"
+
+
+TEST(beginInitializesFourBitTwoLines)
+{
+  testDisplay display;
+
+  CHECK(display.begin() == true);
+  CHECK(display.emulator.isFourBit() == true);
+  CHECK(display.emulator.functionSet() == 0x08);    //DL=0, N=1, F=0
+  CHECK(display.emulator.displayControl() == 0x04); //display on, cursor off, blink off
+  CHECK(display.emulator.entryMode() == 0x02);      //I/D=1, S=0
+  CHECK(display.emulator.backlight() == true);
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(printWritesRows)
+{
+  testDisplay display;
+
+  display.begin();
+
+  display.lcd.print("Hello");
+  display.lcd.setCursor(3, 1);
+  display.lcd.print(F("World"));
+
+  CHECK_TEXT("Hello     ", display.text(0, 0, 10));
+  CHECK_TEXT("   World  ", display.text(0, 1, 10));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(clearBlanksScreen)
+{
+  testDisplay display;
+
+  display.begin();
+
+  display.lcd.print("Hello");
+  display.lcd.clear();
+  display.lcd.print("A");
+
+  CHECK_TEXT("A    ", display.text(0, 0, 5));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(createCharWritesCgram)
+{
+  testDisplay display;
+  uint8_t     glyph[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02};
+
+  display.begin();
+
+  display.lcd.createChar(2, glyph);
+  display.lcd.setCursor(0, 0);
+  display.lcd.write((uint8_t)2);
+
+  for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(16 + i) == glyph[i]);}
+
+  CHECK(display.emulator.ddram(0x00) == 2);
+}
+
+
+TEST(backlightFollowsPolarity)
+{
+  testDisplay display;
+
+  display.begin();
+
+  display.lcd.noBacklight();
+  CHECK(display.emulator.backlight() == false);
+
+  display.lcd.backlight();
+  CHECK(display.emulator.backlight() == true);
+}
+
+
+TEST(busyFlagPacingAvoidsViolations)
+{
+  testDisplay display;
+
+  display.begin(400000);                            //no polling at 100KHz, see "setPacing()"
+
+  CHECK(display.lcd.setPacing(LCD_PACING_BUSY_FLAG) == true);
+
+  display.lcd.clear();
+  display.lcd.print("0123456789ABCDEF");
+  display.lcd.home();
+  display.lcd.print("x");
+
+  CHECK_TEXT("x123456789ABCDEF", display.text(0, 0, 16));
+  CHECK(display.emulator.violations == 0);
+  CHECK(display.lcd.getStats().busyFlagPolls > 0);
+}
+
+
+TEST(framebufferFlushSendsChanges)
+{
+  testDisplay display;
+  uint8_t     buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+
+  display.begin();
+
+  CHECK(display.lcd.enableFramebuffer(buffer, sizeof(buffer)) == true);
+
+  display.lcd.setCursor(2, 1);
+  display.lcd.print("ABC");
+
+  CHECK_TEXT("     ", display.text(0, 1, 5));
+
+  display.lcd.flush();
+
+  CHECK_TEXT("  ABC", display.text(0, 1, 5));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(clearRestoresLeftToRight)
+{
+  testDisplay display;
+
+  display.begin();
+
+  display.lcd.rightToLeft();
+  display.lcd.clear();                              //HD44780 sets I/D=1
+
+  display.lcd.setCursor(10, 0);
+  display.lcd.write('a');
+  display.lcd.setCursor(9, 0);
+  display.lcd.write('b');
+
+  CHECK_TEXT("ba", display.text(9, 0, 2));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(framebufferFlushRightToLeft)
+{
+  testDisplay display;
+  uint8_t     buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+
+  display.begin();
+
+  display.lcd.enableFramebuffer(buffer, sizeof(buffer));
+  display.lcd.rightToLeft();
+  display.lcd.autoscroll();
+
+  display.lcd.setCursor(5, 1);
+  display.lcd.print("ABC");                         //framebuffer cursor moves left
+  display.lcd.flush();
+
+  CHECK_TEXT("   CBA  ", display.text(0, 1, 8));
+  CHECK_TEXT("        ", display.text(0, 0, 8));
+  CHECK(display.emulator.displayShift() == 0);
+  CHECK(display.emulator.entryMode() == 0x01);      //I/D=0, S=1 restored
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(beginTracksAddressForCreateChar)
+{
+  testDisplay display;
+  uint8_t     glyph[8] = {0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F};
+
+  display.begin();
+
+  display.lcd.createChar(0, glyph);
+  display.lcd.print("Hi");                          //DDRAM address is restored after CGRAM write
+
+  CHECK_TEXT("Hi", display.text(0, 0, 2));
+  CHECK(display.emulator.cgram(8) == 0x00);         //CGRAM slot 1 untouched
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(warmRestartKeepTextTracksAddress)
+{
+  testDisplay display;
+  uint8_t     glyph[8] = {0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F};
+
+  display.begin();
+  display.lcd.print("Text");
+
+  display.lcd.setBeginOptions(LCD_BEGIN_WARM | LCD_BEGIN_KEEP_TEXT);
+
+  CHECK(display.begin() == true);
+  CHECK(display.lcd.isWarmRestart() == true);
+
+  display.lcd.createChar(0, glyph);
+  display.lcd.print("Hi");
+
+  CHECK_TEXT("Hixt", display.text(0, 0, 4));
+  CHECK(display.emulator.cgram(8) == 0x00);
+}
+
+
+TEST(tuneSpeedSelectsFastest)
+{
+  testDisplay display;
+
+  display.begin();
+  display.lcd.print("Tune");
+
+  CHECK(display.lcd.tuneSpeed() == true);
+  CHECK(display.lcd.getSpeed() == 1000000);
+  CHECK_TEXT("Tune", display.text(0, 0, 4));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(tuneSpeedKeepsMargin)
+{
+  testDisplay display;
+
+  display.begin();
+  display.lcd.print("Tune");
+
+  Wire.setMaxClock(1100000);                        //1MHz works, 1.25MHz doesn't
+
+  display.lcd.tuneSpeed();
+
+  CHECK(display.lcd.getSpeed() == 400000);
+  CHECK_TEXT("Tune", display.text(0, 0, 4));
+
+  display.lcd.print("d");
+
+  CHECK_TEXT("Tuned", display.text(0, 0, 5));
+}
+
+
+TEST(addressCounterCheckUsesValidAddresses)
+{
+  testDisplay display;
+
+  display.begin(400000);
+  display.lcd.print("AC");
+
+  CHECK(display.lcd.setPacing(LCD_PACING_BUSY_FLAG) == true);
+
+  display.lcd.setBeginOptions(LCD_BEGIN_WARM | LCD_BEGIN_KEEP_TEXT);
+
+  CHECK(display.begin(400000) == true);
+  CHECK(display.lcd.isWarmRestart() == true);
+
+  CHECK(display.emulator.invalidAddresses == 0);
+  CHECK_TEXT("AC", display.text(0, 0, 2));
+}
+
+
+/* emulator with "README.md" pins, RS & DB6 swapped, records every written byte */
+class recordingEmulator : public LcdEmulator
+{
+  public:
+   recordingEmulator() : LcdEmulator(13, 5, 6, 16, 11, 12, 4, 14) {}
+
+   void onWrite(uint8_t value, uint64_t time) {bytes.push_back(value); LcdEmulator::onWrite(value, time);}
+
+   std::vector<uint8_t> bytes;
+};
+
+static void drawMapped(LiquidCrystal_I2C_Base &lcd, recordingEmulator &emulator)
+{
+  Wire.attach(PCF8574_ADDR_A21_A11_A01, &emulator);
+
+  lcd.begin(16, 2, LCD_5x8DOTS, 400000);
+  lcd.print("Mapped");
+  lcd.setCursor(2, 1);
+  lcd.print(42);
+  lcd.noBacklight();
+  lcd.backlight();
+
+  lcd.setPacing(LCD_PACING_BUSY_FLAG);                //warm restart reads busy flag & address counter, see "_decode()"
+  lcd.setBeginOptions(LCD_BEGIN_WARM | LCD_BEGIN_KEEP_TEXT);
+  lcd.begin(16, 2, LCD_5x8DOTS, 400000);
+  lcd.setCursor(6, 0);
+  lcd.print("!");
+
+  Wire.attach(PCF8574_ADDR_A21_A11_A01, NULL);
+}
+
+
+TEST(templateMatchesRuntimeMapping)
+{
+  recordingEmulator runtimeEmulator;
+  recordingEmulator templateEmulator;
+
+  LiquidCrystal_I2C                                          runtimeLcd(PCF8574_ADDR_A21_A11_A01, 13, 5, 6, 16, 11, 12, 4, 14, POSITIVE);
+  LiquidCrystal_I2C_T<13, 5, 6, 16, 11, 12, 4, 14, POSITIVE> templateLcd(PCF8574_ADDR_A21_A11_A01);
+
+  drawMapped(runtimeLcd, runtimeEmulator);
+  drawMapped(templateLcd, templateEmulator);
+
+  CHECK(templateLcd.isWarmRestart() == true);
+  CHECK(templateEmulator.bytes == runtimeEmulator.bytes);
+  CHECK(templateEmulator.violations == 0);
+  CHECK(templateEmulator.backlight() == true);
+  CHECK_TEXT("Mapped!", templateEmulator.text(0, 0, 7));
+  CHECK_TEXT("42", templateEmulator.text(2, 1, 2));
+}
+
+
+TEST(templateHasNoPinTables)
+{
+  CHECK(sizeof(LiquidCrystal_I2C_T<>) == sizeof(LiquidCrystal_I2C_Base));
+  CHECK(sizeof(LiquidCrystal_I2C_T<>) < sizeof(LiquidCrystal_I2C));
+}
+
+
+TEST(pacingAcrossMicrosWrap)
+{
+  testDisplay display;
+  uint8_t     queue[LCD_QUEUE_SIZE(32)];
+
+  display.begin(400000);
+
+  hostTime = (0x100000000ULL - 1500) * 1000;          //"micros()" wraps in 1.5msec, in the middle of "clear()"
+
+  CHECK(display.lcd.setPacing(LCD_PACING_BUSY_FLAG) == true);
+
+  display.lcd.clear();
+  display.lcd.print("Wrap");
+
+  CHECK(display.lcd.getPacing() == LCD_PACING_BUSY_FLAG); //busy flag didn't time out
+  CHECK(display.emulator.violations == 0);
+
+  hostTime = (0x100000000ULL * 2 - 1500) * 1000;
+
+  CHECK(display.lcd.setPacing(LCD_PACING_DELAY) == true);
+  CHECK(display.lcd.enableQueue(queue, sizeof(queue)) == true);
+
+  display.lcd.clear();
+  display.lcd.print("Queue");
+
+  while (display.lcd.tick(4) == true) {}
+
+  CHECK(display.emulator.violations == 0);
+  CHECK_TEXT("Queue", display.text(0, 0, 5));
+}
+
+
+TEST(queueFullWaitsForTick)
+{
+  testDisplay display;
+  uint8_t     queue[LCD_QUEUE_SIZE(4)];
+
+  display.begin();
+
+  CHECK(display.lcd.enableQueue(queue, sizeof(queue)) == true);
+
+  display.lcd.print("0123456789ABCDEF");                            //16 characters into 4 places, "_queuePush()" calls "tick()"
+
+  CHECK(display.lcd.queueLength() == 4);
+
+  while (display.lcd.tick() == true) {}
+
+  display.lcd.disableQueue();
+
+  CHECK(display.lcd.queueLength() == 0);
+  CHECK_TEXT("0123456789ABCDEF", display.text(0, 0, 16));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(queueKeepsOrderWithFlush)
+{
+  testDisplay display;
+  uint8_t     buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+  uint8_t     queue[LCD_QUEUE_SIZE(32)];
+  uint8_t     glyph[8] = {0x04, 0x0E, 0x1F, 0x0E, 0x04, 0x00, 0x00, 0x00};
+
+  display.begin();
+
+  CHECK(display.lcd.enableFramebuffer(buffer, sizeof(buffer)) == true);
+
+  display.lcd.flush();                                              //the 1-st flush sends all cells
+
+  CHECK(display.lcd.enableQueue(queue, sizeof(queue)) == true);
+
+  display.lcd.createChar(1, glyph);                                 //CGRAM address & data queued before DDRAM update
+  display.lcd.setCursor(2, 1);
+  display.lcd.write((uint8_t)1);
+  display.lcd.print("AB");
+
+  Wire.resetStats();
+
+  display.lcd.flush();
+
+  CHECK(Wire.getStats().transactions == 0);                         //"flush()" is queued too
+  CHECK(display.lcd.queueLength() > 8);
+
+  while (display.lcd.tick(4) == true) {}
+
+  display.lcd.disableQueue();
+
+  for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(8 + i) == glyph[i]);}
+
+  CHECK(display.emulator.ddram(0x42) == 1);
+  CHECK_TEXT("AB", display.text(3, 1, 2));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(queueWaitsAfterClear)
+{
+  testDisplay display;
+  uint8_t     queue[LCD_QUEUE_SIZE(8)];
+
+  display.begin();
+
+  display.lcd.print("Hello");
+
+  CHECK(display.lcd.enableQueue(queue, sizeof(queue)) == true);
+
+  display.lcd.clear();
+  display.lcd.print("A");
+
+  CHECK(display.lcd.tick(8) == true);                               //"clear()" ends transaction
+  CHECK(display.lcd.queueLength() == 1);
+
+  Wire.resetStats();
+
+  CHECK(display.lcd.tick(8) == true);                               //LCD is still clearing
+  CHECK(Wire.getStats().transactions == 0);
+
+  hostTime += LCD_EMULATOR_CLEAR_TIME;
+
+  CHECK(display.lcd.tick(8) == true);                               //"LCD_HOME_CLEAR_DELAY" is longer than HD44780 clear
+  CHECK(Wire.getStats().transactions == 0);
+
+  hostTime += (LCD_HOME_CLEAR_DELAY * 1000000ULL) - LCD_EMULATOR_CLEAR_TIME;
+
+  CHECK(display.lcd.tick(8) == false);
+  CHECK(Wire.getStats().transactions == 1);
+
+  CHECK_TEXT("A    ", display.text(0, 0, 5));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(statsMatchBusTraffic)
+{
+  testDisplay display;
+
+  display.begin();
+
+  display.lcd.print("Hello");
+
+  lcdStats stats = display.lcd.getStats();
+
+  CHECK(stats.transactions > 0);
+  CHECK(stats.pacingTime > 0);
+
+  Wire.resetStats();
+
+  display.begin();                                                  //starts statistics from zero
+
+  stats = display.lcd.getStats();
+
+  CHECK(stats.transactions == Wire.getStats().transactions - 1);   //PCF8574 probe isn't LCD traffic
+  CHECK(stats.bytes == Wire.getStats().bytes);
+  CHECK(stats.busyFlagPolls == 0);
+
+  display.lcd.resetStats();
+
+  stats = display.lcd.getStats();
+
+  CHECK(stats.transactions == 0);
+  CHECK(stats.bytes == 0);
+  CHECK(stats.pacingTime == 0);
+}
+
+
+TEST(statsCountBusErrors)
+{
+  testDisplay display;
+
+  display.begin();
+
+  Wire.attach(PCF8574_ADDR_A21_A11_A01, NULL);                      //PCF8574 NACKs address
+
+  display.lcd.print("AB");
+
+  lcdStats stats = display.lcd.getStats();
+
+  CHECK(stats.errors[1] == 1);                                      //"Wire.endTransmission()" code 2, both characters in one transaction
+  CHECK(stats.errors[0] == 0);
+
+  Wire.attach(PCF8574_ADDR_A21_A11_A01, &display.emulator);
+
+  display.begin();
+
+  stats = display.lcd.getStats();
+
+  CHECK(stats.errors[1] == 0);
+  CHECK(stats.readErrors == 0);
+}
+
+
+TEST(calibrateTimingFindsClearDuration)
+{
+  testDisplay display;
+  uint32_t    measured = LCD_EMULATOR_CLEAR_TIME / 1000;
+
+  display.begin(400000);
+
+  display.lcd.print("lost");
+
+  CHECK(display.lcd.calibrateTiming() == true);
+  CHECK(display.emulator.violations == 0);
+  CHECK_TEXT("    ", display.text(0, 0, 4));                       //display is cleared after calibration
+
+  display.lcd.resetStats();
+  display.lcd.setCursor(0, 0);
+
+  uint32_t commandDelay = display.lcd.getStats().pacingTime;
+
+  display.lcd.resetStats();
+  display.lcd.clear();                                              //fixed delays are command & calibrated "clear()" duration
+
+  uint32_t clearDelay = display.lcd.getStats().pacingTime - commandDelay;
+
+  CHECK(clearDelay >= (measured + (measured * LCD_CALIBRATION_MARGIN / 100)));                                       //never shorter than LCD
+  CHECK(clearDelay <= (measured + LCD_CALIBRATION_STEP + 100) + ((measured + LCD_CALIBRATION_STEP + 100) * LCD_CALIBRATION_MARGIN / 100)); //step & BF read time
+  CHECK(clearDelay < LCD_HOME_CLEAR_DELAY * 1000);
+
+  display.lcd.print("Calibrated");
+  display.lcd.home();
+  display.lcd.print("c");
+
+  CHECK_TEXT("calibrated", display.text(0, 0, 10));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(calibrateTimingNeedsBlockingIO)
+{
+  testDisplay display;
+  uint8_t     queue[LCD_QUEUE_SIZE(8)];
+
+  display.begin(400000);
+
+  CHECK(display.lcd.calibrateTiming(0) == false);
+
+  display.lcd.enableQueue(queue, sizeof(queue));
+
+  CHECK(display.lcd.calibrateTiming() == false);
+
+  display.lcd.disableQueue();
+  display.lcd.resetStats();
+  display.lcd.clear();
+
+  CHECK(display.lcd.getStats().pacingTime == LCD_COMMAND_DELAY + (LCD_HOME_CLEAR_DELAY * 1000)); //datasheet timing is kept
+}
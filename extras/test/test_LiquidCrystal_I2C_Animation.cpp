@@ -0,0 +1,128 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Animation tests, 16x2 display with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - frame "n" has "n" in every row, CGRAM of the slot shows current frame
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Animation.h>
+
+
+static const uint8_t frames[3][LCD_ANIMATION_ROWS] PROGMEM =
+{
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+  {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
+  {0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02}
+};
+
+
+static bool frameShown(testDisplay &display, uint8_t slot, uint8_t frame)
+{
+  for (uint8_t i = 0; i < LCD_ANIMATION_ROWS; i++)
+  {
+    if (display.emulator.cgram((slot * 8) + i) != frame) {return false;}
+  }
+
+  return true;
+}
+
+
+TEST(animationCyclesFrames)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Animation spinner(display.lcd, 3, frames[0], 3, 100);
+
+  display.begin();
+
+  spinner.begin();
+
+  CHECK(frameShown(display, 3, 0) == true);
+  CHECK(spinner.tick() == false);                                   //frame time isn't elapsed
+
+  for (uint8_t i = 1; i <= 4; i++)
+  {
+    hostTime += 100000000;
+
+    CHECK(spinner.tick() == true);
+    CHECK(spinner.getFrame() == (i % 3));
+    CHECK(frameShown(display, 3, i % 3) == true);
+  }
+
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(animationPauseAndSetFrame)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Animation blinker(display.lcd, 0, frames[0], 3, 100);
+
+  display.begin();
+
+  blinker.begin();
+  blinker.pause();
+
+  hostTime += 500000000;
+
+  CHECK(blinker.tick() == false);
+  CHECK(blinker.getFrame() == 0);
+
+  blinker.setFrame(5);                                              //frame number wraps
+
+  CHECK(blinker.getFrame() == 2);
+  CHECK(frameShown(display, 0, 2) == true);
+
+  blinker.play();
+
+  CHECK(blinker.tick() == false);                                   //frame time restarts on "play()"
+
+  hostTime += 100000000;
+
+  CHECK(blinker.tick() == true);
+  CHECK(frameShown(display, 0, 0) == true);
+}
+
+
+TEST(animationRestoresDdramAddress)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Animation spinner(display.lcd, 1, frames[0], 3, 100);
+
+  display.begin();
+
+  spinner.begin();
+
+  display.lcd.setCursor(5, 1);
+  display.lcd.print("AB");
+
+  hostTime += 100000000;
+
+  CHECK(spinner.tick() == true);                                    //CGRAM write moves address counter to CGRAM
+
+  display.lcd.print("C");
+
+  CHECK_TEXT("ABC", display.text(5, 1, 3));
+  CHECK(display.emulator.ddram(0x00) == ' ');                       //"C" isn't written to CGRAM or DDRAM start
+  CHECK(frameShown(display, 1, 1) == true);
+
+  display.lcd.cursor();
+
+  hostTime += 100000000;
+
+  CHECK(spinner.tick() == true);
+  CHECK(display.emulator.isCgram() == false);                       //visible cursor is moved back at once
+  CHECK(display.emulator.addressCounter() == 0x48);
+  CHECK(frameShown(display, 1, 2) == true);
+  CHECK(display.emulator.violations == 0);
+}
@@ -0,0 +1,150 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_BigDigits tests, 16x2 & 20x4 displays with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - digit "n" takes columns "column + n * 4..column + n * 4 + 2"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_BigDigits.h>
+
+
+static const uint8_t upperBar[8]  = {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00}; //segment 1
+static const uint8_t thinBars[8]  = {0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F}; //segment 7
+
+
+static bool cellsEqual(testDisplay &display, uint8_t address, const uint8_t *cells)
+{
+  for (uint8_t i = 0; i < LCD_BIG_DIGIT_WIDTH; i++)
+  {
+    if (display.emulator.ddram(address + i) != cells[i]) {return false;}
+  }
+
+  return true;
+}
+
+
+TEST(bigDigitsUploadsSegments)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_BigDigits digits(display.lcd, 0, 0, 4);
+
+  display.begin();
+  digits.begin();
+
+  for (uint8_t i = 0; i < 8; i++)                                   //segments from PROGMEM tables
+  {
+    CHECK(display.emulator.cgram(8 + i)  == upperBar[i]);
+    CHECK(display.emulator.cgram(56 + i) == thinBars[i]);
+  }
+
+  CHECK_TEXT("                ", display.text(0, 0, 16));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(bigDigitsPrintsRightAligned)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_BigDigits digits(display.lcd, 0, 0, 4);
+  const uint8_t               zeroTop[3]    = {0, 1, 2};
+  const uint8_t               zeroBottom[3] = {3, 4, 5};
+  const uint8_t               oneTop[3]     = {1, 2, ' '};
+  const uint8_t               oneBottom[3]  = {4, 0xFF, 4};
+
+  display.begin();
+  digits.begin();
+
+  digits.print(10);
+
+  CHECK_TEXT("        ", display.text(0, 0, 8));
+  CHECK(cellsEqual(display, 0x08, oneTop)     == true);
+  CHECK(cellsEqual(display, 0x48, oneBottom)  == true);
+  CHECK(cellsEqual(display, 0x0C, zeroTop)    == true);
+  CHECK(cellsEqual(display, 0x4C, zeroBottom) == true);
+
+  uint32_t characters = display.emulator.characters;
+
+  digits.print(11);                                                 //only the last digit is redrawn
+
+  CHECK(display.emulator.characters - characters == 2 * LCD_BIG_DIGIT_WIDTH);
+  CHECK(cellsEqual(display, 0x0C, oneTop) == true);
+
+  digits.print(7, true);
+
+  CHECK(cellsEqual(display, 0x00, zeroTop) == true);                //leading zeros
+  CHECK(cellsEqual(display, 0x08, zeroTop) == true);
+}
+
+
+TEST(bigDigitsDropsDigitsOffScreen)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_BigDigits digits(display.lcd, 2, 0, 10);        //10 digits asked, 16 columns fit 3 from column 2
+  const uint8_t               oneTop[3] = {1, 2, ' '};
+  const uint8_t               twoTop[3] = {6, 6, 2};
+
+  display.begin();
+  digits.begin();
+
+  digits.print(1212);                                               //cut to the last digits
+
+  CHECK(cellsEqual(display, 0x02, twoTop) == true);
+  CHECK(cellsEqual(display, 0x06, oneTop) == true);
+  CHECK(cellsEqual(display, 0x0A, twoTop) == true);
+  CHECK_TEXT("   ", display.text(13, 0, 3));                       //nothing after the last digit
+  CHECK(display.emulator.ddram(0x10) == ' ');                       //nothing outside of the screen
+  CHECK(display.emulator.ddram(0x50) == ' ');
+
+  digits.printDigit(3, 8);                                          //off the screen
+
+  CHECK(display.emulator.ddram(0x0E) == ' ');
+  CHECK(display.emulator.invalidAddresses == 0);
+}
+
+
+TEST(bigDigitsDropsDigitsBelowScreen)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_BigDigits digits(display.lcd, 0, 0, 4, 3);      //3 rows on 2 rows display
+
+  display.begin();
+
+  uint32_t characters = display.emulator.characters;
+
+  digits.begin();
+  digits.print(8888);
+
+  CHECK(display.emulator.characters - characters == 8 * 8);         //segments only, no digit fits
+  CHECK_TEXT("                ", display.text(0, 0, 16));
+}
+
+
+TEST(bigDigitsThreeRows)
+{
+  testDisplay                 display(20, 4);
+  LiquidCrystal_I2C_BigDigits digits(display.lcd, 1, 1, 5, 3);
+  const uint8_t               twoTop[3]    = {1, 1, 2};
+  const uint8_t               twoMiddle[3] = {0, 7, 7};
+  const uint8_t               twoBottom[3] = {3, 4, 4};
+
+  display.begin();
+  digits.begin();
+
+  digits.print(42);
+
+  CHECK(cellsEqual(display, 0x40 + 17, twoTop)    == true);         //5-th digit of 2-nd row, 20x4 row 1 starts at 0x40
+  CHECK(cellsEqual(display, 0x14 + 17, twoMiddle) == true);         //row 2 starts at 0x14
+  CHECK(cellsEqual(display, 0x54 + 17, twoBottom) == true);         //row 3 starts at 0x54
+  CHECK(display.emulator.invalidAddresses == 0);
+}
@@ -0,0 +1,94 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Checker tests, mock bus & checked "Wire" with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Checker.h>
+
+
+class stringPrint : public Print
+{
+  public:
+   size_t write(uint8_t character) {text += (char)character; return 1;}
+
+   using Print::write;
+
+   std::string text;
+};
+
+
+static const lcdTimingProfile slowProfile = {"slow", 1000, 450, 60, 20, 195, 10, 500, 1520, 40, 4100, 100}; //500usec per command
+
+
+TEST(checkerMockBusNoViolations)
+{
+  LiquidCrystal_I2C_Checker checker(lcdProfileHD44780);
+  LiquidCrystal_I2C         lcd(checker);
+  uint8_t                   glyph[8] = {0x04, 0x0E, 0x1F, 0x0E, 0x04, 0x00, 0x00, 0x00};
+
+  CHECK(lcd.begin(16, 2) == true);
+
+  lcd.print("Hello");
+  lcd.createChar(1, glyph);
+  lcd.setCursor(0, 1);
+  lcd.print(12345);
+  lcd.clear();
+
+  CHECK(checker.getViolations(LCD_CHECK_ALL & ~LCD_CHECK_ADDRESS_SETUP) == 0);
+  CHECK(checker.getViolations(LCD_CHECK_ADDRESS_SETUP) == 6);  //RS changes together with E, see "setRules()"
+}
+
+
+TEST(checkerPassesToWire)
+{
+  testDisplay               display;
+  LiquidCrystal_I2C_Checker checker(lcdProfileHD44780, &lcdDefaultBus);
+  LiquidCrystal_I2C         lcd(checker);
+
+  checker.setRules(LCD_CHECK_ALL & ~LCD_CHECK_ADDRESS_SETUP);
+
+  CHECK(lcd.begin(16, 2, LCD_5x8DOTS, 400000) == true);
+
+  lcd.setCursor(4, 1);
+  lcd.print("Checked");
+
+  CHECK_TEXT("    Checked ", display.text(0, 1, 12));
+  CHECK(checker.getViolations() == 0);
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(checkerReportsBusyWrites)
+{
+  LiquidCrystal_I2C_Checker checker(slowProfile);
+  LiquidCrystal_I2C         lcd(checker);
+  stringPrint               out;
+
+  checker.setRules(LCD_CHECK_ALL & ~LCD_CHECK_ADDRESS_SETUP);
+
+  lcd.begin(16, 2, LCD_5x8DOTS, 400000);
+
+  checker.clear();
+
+  LCD_CHECKER_MARK(checker);
+  lcd.print("ABC");
+
+  CHECK(checker.getViolations(LCD_CHECK_BUSY) > 0);
+  CHECK(checker.getViolations(LCD_CHECK_ALL & ~LCD_CHECK_BUSY) == 0);
+
+  checker.report(out);
+
+  CHECK(out.text.find("slow timing") == 0);
+  CHECK(out.text.find("busy") != std::string::npos);
+  CHECK(out.text.find("test_LiquidCrystal_I2C_Checker.cpp") != std::string::npos);
+}
@@ -0,0 +1,143 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Fields tests, 16x2 display with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Fields.h>
+
+
+TEST(fieldsFormatDecimals)
+{
+  testDisplay              display;
+  LiquidCrystal_I2C_Fields fields(display.lcd);
+
+  display.begin();
+
+  uint8_t price = fields.addField(0, 0, 7, LCD_ALIGN_RIGHT, 2);
+  uint8_t small = fields.addField(8, 0, 6, LCD_ALIGN_LEFT,  3);
+
+  fields.updateField(price, 1234);
+  fields.updateField(small, 0);
+
+  CHECK_TEXT("  12.34 0.000 ", display.text(0, 0, 14));
+
+  fields.updateField(price, -5);                                    //at least one digit before decimal point
+  fields.updateField(small, -12);
+
+  CHECK_TEXT("  -0.05 -0.012", display.text(0, 0, 14));
+
+  fields.updateField(price, 100);
+
+  CHECK_TEXT("   1.00", display.text(0, 0, 7));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(fieldsMaxWidth)
+{
+  testDisplay              display;
+  LiquidCrystal_I2C_Fields fields(display.lcd);
+
+  display.begin();
+
+  display.lcd.print("0123456789ABCDEF");
+
+  uint8_t wide    = fields.addField(0, 0, 20);                      //cut to 12 characters
+  uint8_t decimal = fields.addField(0, 1, 12, LCD_ALIGN_RIGHT, 12); //cut to 9 decimals
+
+  fields.updateField(wide, (int32_t)0x80000000);                    //"-2147483648", the longest int32_t
+
+  CHECK_TEXT(" -2147483648CDEF", display.text(0, 0, 16));           //columns after 12-th are untouched
+
+  fields.updateField(decimal, (int32_t)0x80000000);
+
+  CHECK_TEXT("-2.147483648", display.text(0, 1, 12));               //sign, decimal point & 10 digits fill all 12 characters
+
+  fields.updateField(decimal, 7);
+
+  CHECK_TEXT(" 0.000000007", display.text(0, 1, 12));
+
+  fields.updateField(wide, "text longer than 12");
+
+  CHECK_TEXT("text longer CDEF", display.text(0, 0, 16));
+}
+
+
+TEST(fieldsOverflowAndText)
+{
+  testDisplay              display;
+  LiquidCrystal_I2C_Fields fields(display.lcd);
+
+  display.begin();
+
+  uint8_t narrow = fields.addField(2, 1, 4);
+  uint8_t label  = fields.addField(8, 1, 5, LCD_ALIGN_LEFT);
+
+  fields.updateField(narrow, 12345);
+
+  CHECK_TEXT("####", display.text(2, 1, 4));
+
+  fields.updateField(narrow, -999);
+
+  CHECK_TEXT("-999", display.text(2, 1, 4));
+
+  fields.updateField(label, "on");
+
+  CHECK_TEXT("on   ", display.text(8, 1, 5));
+
+  fields.updateField(99, 1);                                        //unknown field is ignored
+
+  CHECK(display.emulator.invalidAddresses == 0);
+}
+
+
+TEST(fieldsSendChangedCharacters)
+{
+  testDisplay              display;
+  LiquidCrystal_I2C_Fields fields(display.lcd);
+
+  display.begin();
+
+  uint8_t counter = fields.addField(4, 0, 6);
+
+  fields.updateField(counter, 1234);
+
+  uint32_t characters = display.emulator.characters;
+
+  fields.updateField(counter, 1235);
+
+  CHECK(display.emulator.characters - characters == 1);
+
+  characters = display.emulator.characters;
+
+  fields.updateField(counter, 1235);
+
+  CHECK(display.emulator.characters == characters);
+
+  fields.invalidate();
+  fields.updateField(counter, 1235);
+
+  CHECK(display.emulator.characters - characters == 6);             //the whole field after "invalidate()"
+  CHECK_TEXT("  1235", display.text(4, 0, 6));
+}
+
+
+TEST(fieldsLimit)
+{
+  testDisplay              display;
+  LiquidCrystal_I2C_Fields fields(display.lcd);
+
+  for (uint8_t i = 0; i < LCD_FIELDS_MAX; i++) {CHECK(fields.addField(i, 0, 1) == i);}
+
+  CHECK(fields.addField(0, 1, 1) == LCD_FIELD_NONE);
+}
@@ -0,0 +1,146 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_GlyphCache tests, 16x2 display with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - glyph "n" has "n" in the 1-st row, CGRAM of a slot shows which glyph
+     is loaded
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_GlyphCache.h>
+
+
+static uint8_t glyphs[12][LCD_GLYPH_ROWS];
+
+
+static void makeGlyphs()
+{
+  for (uint8_t i = 0; i < 12; i++)
+  {
+    for (uint8_t row = 0; row < LCD_GLYPH_ROWS; row++) {glyphs[i][row] = (row == 0) ? i : 0x1F;}
+  }
+}
+
+
+TEST(glyphCacheReusesLoadedGlyph)
+{
+  testDisplay                  display;
+  LiquidCrystal_I2C_GlyphCache cache(display.lcd);
+
+  makeGlyphs();
+  display.begin();
+
+  CHECK(cache.load(glyphs[0]) == 0);
+  CHECK(cache.load(glyphs[1]) == 1);
+
+  Wire.resetStats();
+
+  CHECK(cache.load(glyphs[0]) == 0);
+  CHECK(Wire.getStats().transactions == 0);                         //nothing is sent for loaded glyph
+  CHECK(display.emulator.cgram(8) == 1);
+}
+
+
+TEST(glyphCacheKeepsSlotsWithoutFramebuffer)
+{
+  testDisplay                  display;
+  LiquidCrystal_I2C_GlyphCache cache(display.lcd);
+
+  makeGlyphs();
+  display.begin();
+
+  for (uint8_t i = 0; i < LCD_CGRAM_SLOTS; i++)
+  {
+    CHECK(cache.load(glyphs[i]) == i);
+
+    display.lcd.write(i);
+  }
+
+  CHECK(cache.load(glyphs[8]) == LCD_GLYPH_NOT_LOADED);             //screen contents is unknown, every glyph may be visible
+
+  for (uint8_t i = 0; i < LCD_CGRAM_SLOTS; i++) {CHECK(display.emulator.cgram(i * 8) == i);}
+
+  cache.release(3);
+
+  CHECK(cache.load(glyphs[8]) == 3);
+  CHECK(display.emulator.cgram(3 * 8) == 8);
+  CHECK(cache.load(glyphs[9]) == LCD_GLYPH_NOT_LOADED);             //released slot is in use again
+}
+
+
+TEST(glyphCacheReplacesHiddenGlyph)
+{
+  testDisplay                  display;
+  LiquidCrystal_I2C_GlyphCache cache(display.lcd);
+  uint8_t                      buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+
+  makeGlyphs();
+  display.begin();
+
+  CHECK(display.lcd.enableFramebuffer(buffer, sizeof(buffer)) == true);
+
+  for (uint8_t i = 0; i < LCD_CGRAM_SLOTS; i++) {CHECK(cache.load(glyphs[i]) == i);}
+
+  display.lcd.write((uint8_t)0);                                    //glyphs 0, 1 & 3 are on the screen
+  display.lcd.write((uint8_t)1);
+  display.lcd.write((uint8_t)(3 + 8));                              //8..15 share CGRAM with 0..7
+  display.lcd.flush();
+
+  CHECK(cache.load(glyphs[8]) == 2);                                //least recently used hidden glyph
+  CHECK(cache.load(glyphs[9]) == 4);
+  CHECK(display.emulator.cgram(2 * 8) == 8);
+  CHECK(display.emulator.cgram(4 * 8) == 9);
+  CHECK(display.emulator.cgram(3 * 8) == 3);
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(glyphCacheSlotRange)
+{
+  testDisplay                  display;
+  LiquidCrystal_I2C_GlyphCache cache(display.lcd, 6, 2);
+  uint8_t                      buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+
+  makeGlyphs();
+  display.begin();
+
+  CHECK(display.lcd.enableFramebuffer(buffer, sizeof(buffer)) == true);
+
+  CHECK(cache.load(glyphs[0]) == 6);
+  CHECK(cache.load(glyphs[1]) == 7);
+  CHECK(cache.load(glyphs[2]) == 6);                                //slots 0..5 are never touched
+  CHECK(display.emulator.cgram(6 * 8) == 2);
+
+  cache.release(5);                                                 //outside of cache range, ignored
+
+  CHECK(cache.load(glyphs[3]) == 7);
+}
+
+
+#if defined (PROGMEM)
+static const uint8_t flashGlyph[LCD_GLYPH_ROWS] PROGMEM = {0x0A, 0x1F, 0x1F, 0x0E, 0x04, 0x00, 0x00, 0x00};
+
+TEST(glyphCacheLoadsFlashGlyph)
+{
+  testDisplay                  display;
+  LiquidCrystal_I2C_GlyphCache cache(display.lcd);
+
+  display.begin();
+
+  CHECK(cache.load(flashGlyph) == 0);
+
+  for (uint8_t i = 0; i < LCD_GLYPH_ROWS; i++) {CHECK(display.emulator.cgram(i) == flashGlyph[i]);}
+
+  CHECK(cache.load(flashGlyph) == 0);
+}
+#endif
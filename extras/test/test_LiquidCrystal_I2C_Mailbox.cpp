@@ -0,0 +1,115 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Mailbox stress tests, producers in threads & one consumer
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - every record is "producer:sequence" text, consumer checks records
+     are intact & in per-producer order
+   - producers retry full ring, so all records are delivered
+   - "make tsan" runs these tests with ThreadSanitizer
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Mailbox.h>
+
+#define MAILBOX_RECORDS 4000                        //records per producer
+
+
+class recordingLcd : public LiquidCrystal_I2C
+{
+  public:
+   size_t write(const uint8_t *buffer, size_t size)
+   {
+     records.push_back(std::string((const char *)buffer, size));
+
+     return LiquidCrystal_I2C::write(buffer, size);
+   }
+
+   using LiquidCrystal_I2C::write;
+
+   std::vector<std::string> records;
+};
+
+
+static void producer(LiquidCrystal_I2C_Mailbox *mailbox, uint8_t id)
+{
+  char text[16];
+
+  for (uint32_t sequence = 0; sequence < MAILBOX_RECORDS; sequence++)
+  {
+    snprintf(text, sizeof(text), "%u:%lu", id, (unsigned long)sequence);
+
+    while (mailbox->post(id, sequence & 0x01, text) == false) {std::this_thread::yield();} //ring is full, wait for consumer
+  }
+}
+
+
+static bool stress(uint8_t producers, lcdMailboxMode mode)
+{
+  LcdEmulator  emulator;
+  recordingLcd lcd;
+  uint8_t      ring[256];
+
+  Wire.attach(PCF8574_ADDR_A21_A11_A01, &emulator);
+
+  lcd.begin(40, 2);
+
+  LiquidCrystal_I2C_Mailbox mailbox(lcd, ring, sizeof(ring), mode);
+
+  std::vector<std::thread> threads;
+  uint32_t                 total = (uint32_t)producers * MAILBOX_RECORDS;
+
+  for (uint8_t id = 0; id < producers; id++) {threads.push_back(std::thread(producer, &mailbox, id));}
+
+  while (lcd.records.size() < total) {if (mailbox.drain() == 0) {std::this_thread::yield();}}
+
+  for (size_t i = 0; i < threads.size(); i++) {threads[i].join();}
+
+  Wire.attach(PCF8574_ADDR_A21_A11_A01, NULL);
+
+  std::vector<long> next(producers, 0);
+
+  for (size_t i = 0; i < lcd.records.size(); i++)
+  {
+    unsigned int  id;
+    unsigned long sequence;
+    char          tail;
+
+    if (sscanf(lcd.records[i].c_str(), "%u:%lu%c", &id, &sequence, &tail) != 2) {printf("corrupted record \"%s\"\n", lcd.records[i].c_str()); return false;}
+    if ((id >= producers) || ((long)sequence != next[id]))                          {printf("out of order record \"%s\"\n", lcd.records[i].c_str()); return false;}
+
+    next[id]++;
+  }
+
+  return (mailbox.drain() == 0) && (emulator.violations == 0);
+}
+
+
+TEST(mailboxSingleProducer)
+{
+  CHECK(stress(1, LCD_MAILBOX_SINGLE_PRODUCER) == true);
+}
+
+
+TEST(mailboxFourProducers)
+{
+  CHECK(stress(4, LCD_MAILBOX_MULTI_PRODUCER) == true);
+}
+
+
+TEST(mailboxEightProducers)
+{
+  CHECK(stress(8, LCD_MAILBOX_MULTI_PRODUCER) == true);
+}
@@ -0,0 +1,137 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Marquee tests, 16x1 & 16x2 displays with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - visible column "c" shows DDRAM character "(c + steps) % line size"
+     of the row, 80 in 1-line mode & 40 in 2-line mode
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Marquee.h>
+
+
+static std::string visible(testDisplay &display, uint8_t row, uint16_t steps, uint8_t lineSize)
+{
+  std::string result;
+
+  for (uint8_t column = 0; column < 16; column++) {result += (char)display.emulator.ddram((row * 0x40) + ((column + steps) % lineSize));}
+
+  return result;
+}
+
+
+static std::string expected(const char *text, uint16_t period, uint16_t steps)
+{
+  std::string result;
+  uint16_t    length = strlen(text);
+
+  for (uint8_t column = 0; column < 16; column++)
+  {
+    uint16_t index = (steps + column) % period;
+
+    result += (index < length) ? text[index] : ' ';
+  }
+
+  return result;
+}
+
+
+TEST(marqueeOneLineShortText)
+{
+  testDisplay               display(16, 1);
+  LiquidCrystal_I2C_Marquee marquee(display.lcd, 16);
+  const char               *text = "1-line mode uses the whole 80 characters DDRAM line";
+
+  CHECK(display.begin() == true);
+
+  marquee.setText(0, text);
+  marquee.begin();
+
+  CHECK(visible(display, 0, 0, 80) == expected(text, 80, 0));
+
+  for (uint16_t steps = 1; steps <= 100; steps++)
+  {
+    marquee.step();
+
+    CHECK(visible(display, 0, steps, 80) == expected(text, 80, steps));  //text is 51 characters, wraps after 80 steps, not 40
+  }
+
+  CHECK(display.emulator.invalidAddresses == 0);
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(marqueeOneLineLongText)
+{
+  testDisplay               display(16, 1);
+  LiquidCrystal_I2C_Marquee marquee(display.lcd, 16);
+  const char               *text = "text longer than 80 characters DDRAM line is loaded in pieces outside of the screen";
+
+  CHECK(display.begin() == true);
+
+  marquee.setText(0, text);
+  marquee.begin();
+
+  uint16_t period = strlen(text) + LCD_MARQUEE_GAP;
+
+  for (uint16_t steps = 1; steps <= 200; steps++)
+  {
+    marquee.step();
+
+    CHECK(visible(display, 0, steps, 80) == expected(text, period, steps));
+  }
+
+  CHECK(display.emulator.invalidAddresses == 0);
+}
+
+
+TEST(marqueeOneLineIgnoresSecondRow)
+{
+  testDisplay               display(16, 1);
+  LiquidCrystal_I2C_Marquee marquee(display.lcd, 16);
+
+  CHECK(display.begin() == true);
+
+  marquee.setText(0, "row 0");
+  marquee.setText(1, "row 1");
+  marquee.begin();
+
+  CHECK(display.text(0, 0, 16) == "row 0           ");
+  CHECK(display.emulator.ddram(0x40) == ' ');                           //0x40 is 65-th character of 1-line mode, not 2-nd row
+  CHECK(display.emulator.invalidAddresses == 0);
+}
+
+
+TEST(marqueeTwoLines)
+{
+  testDisplay               display(16, 2);
+  LiquidCrystal_I2C_Marquee marquee(display.lcd, 16);
+  const char               *top    = "short";
+  const char               *bottom = "bottom row text is longer than 40 characters DDRAM line";
+
+  CHECK(display.begin() == true);
+
+  marquee.setText(0, top);
+  marquee.setText(1, bottom);
+  marquee.begin();
+
+  for (uint16_t steps = 1; steps <= 120; steps++)
+  {
+    marquee.step();
+
+    CHECK(visible(display, 0, steps, 40) == expected(top, 40, steps));
+    CHECK(visible(display, 1, steps, 40) == expected(bottom, strlen(bottom) + LCD_MARQUEE_GAP, steps));
+  }
+
+  CHECK(display.emulator.invalidAddresses == 0);
+}
@@ -0,0 +1,172 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Meter tests, 16x2 display with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Meter.h>
+
+
+TEST(meterHorizontalBlocks)
+{
+  testDisplay             display;
+  LiquidCrystal_I2C_Meter meter(display.lcd, LCD_METER_HORIZONTAL, 2, 0, 10);
+
+  display.begin();
+  meter.begin();
+
+  CHECK(meter.resolution() == 50);
+
+  for (uint8_t n = 1; n < LCD_METER_H_STEPS; n++)                   //block "n" has "n" left columns
+  {
+    for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(((n - 1) * 8) + i) == ((0x1F << (5 - n)) & 0x1F));}
+  }
+
+  meter.drawLevel(12);
+
+  CHECK(display.emulator.ddram(0x02) == LCD_METER_FULL_BLOCK);
+  CHECK(display.emulator.ddram(0x03) == LCD_METER_FULL_BLOCK);
+  CHECK(display.emulator.ddram(0x04) == 1);                         //2 of 5 columns
+  CHECK(display.emulator.ddram(0x05) == ' ');
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(meterRewritesChangedCellsOnly)
+{
+  testDisplay             display;
+  LiquidCrystal_I2C_Meter meter(display.lcd, LCD_METER_HORIZONTAL, 0, 1, 10);
+
+  display.begin();
+  meter.begin();
+  meter.drawLevel(22);
+
+  uint32_t characters = display.emulator.characters;
+
+  meter.drawLevel(23);                                              //inside cell 4
+
+  CHECK(display.emulator.characters - characters == 1);
+  CHECK(display.emulator.ddram(0x44) == 2);
+
+  characters = display.emulator.characters;
+
+  meter.drawLevel(6);                                               //from cell 4 down to cell 1
+
+  CHECK(display.emulator.characters - characters == 4);
+  CHECK(display.emulator.ddram(0x40) == LCD_METER_FULL_BLOCK);
+  CHECK(display.emulator.ddram(0x41) == 0);
+  CHECK_TEXT("   ", display.text(2, 1, 3));
+
+  characters = display.emulator.characters;
+
+  meter.drawLevel(25);                                              //cell 4 becomes full, cell 5 stays empty
+
+  CHECK(display.emulator.characters - characters == 4);
+  CHECK(display.emulator.ddram(0x44) == LCD_METER_FULL_BLOCK);
+  CHECK(display.emulator.ddram(0x45) == ' ');
+
+  characters = display.emulator.characters;
+
+  meter.drawLevel(25);                                              //same level
+
+  CHECK(display.emulator.characters == characters);
+}
+
+
+TEST(meterFullAndEmptyValues)
+{
+  testDisplay             display;
+  LiquidCrystal_I2C_Meter meter(display.lcd, LCD_METER_HORIZONTAL, 0, 0, 16);
+
+  display.begin();
+  meter.begin();
+
+  meter.draw(1000, 1000);
+
+  for (uint8_t i = 0; i < 16; i++) {CHECK(display.emulator.ddram(i) == LCD_METER_FULL_BLOCK);}
+
+  meter.draw(5000, 1000);                                           //value above maximum is full meter
+
+  for (uint8_t i = 0; i < 16; i++) {CHECK(display.emulator.ddram(i) == LCD_METER_FULL_BLOCK);}
+
+  meter.draw(0, 1000);
+
+  CHECK_TEXT("                ", display.text(0, 0, 16));
+
+  meter.draw(500, 0);                                               //zero maximum is ignored
+
+  CHECK_TEXT("                ", display.text(0, 0, 16));
+
+  meter.drawLevel(0xFFFF);                                          //level above resolution is full meter
+
+  for (uint8_t i = 0; i < 16; i++) {CHECK(display.emulator.ddram(i) == LCD_METER_FULL_BLOCK);}
+
+  CHECK(display.emulator.invalidAddresses == 0);
+}
+
+
+TEST(meterVerticalGrowsUp)
+{
+  testDisplay             display;
+  LiquidCrystal_I2C_Meter meter(display.lcd, LCD_METER_VERTICAL, 5, 1, 2);
+
+  display.begin();
+  meter.begin();
+
+  CHECK(meter.resolution() == 16);
+
+  meter.drawLevel(11);
+
+  CHECK(display.emulator.ddram(0x45) == LCD_METER_FULL_BLOCK);      //bottom cell
+  CHECK(display.emulator.ddram(0x05) == 2);                         //3 of 8 rows
+
+  for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(16 + i) == ((i >= 5) ? 0x1F : 0x00));}
+
+  meter.drawLevel(0);
+
+  CHECK(display.emulator.ddram(0x45) == ' ');
+  CHECK(display.emulator.ddram(0x05) == ' ');
+}
+
+
+TEST(meterSlotBounds)
+{
+  testDisplay             display;
+  uint8_t                 glyph[8] = {0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A};
+  LiquidCrystal_I2C_Meter horizontal(display.lcd, LCD_METER_HORIZONTAL, 0, 0, 4, 6); //4 slots, moved to 4..7
+  LiquidCrystal_I2C_Meter vertical(display.lcd, LCD_METER_VERTICAL, 15, 1, 9, 3);     //7 slots, moved to 1..7, 2 rows only
+
+  display.begin();
+
+  display.lcd.createChar(0, glyph);
+
+  horizontal.begin();
+
+  for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(i) == glyph[i]);}  //slot 0 is never touched
+
+  CHECK(display.emulator.cgram(4 * 8) == 0x10);                     //block 1 in slot 4
+  CHECK(display.emulator.cgram(7 * 8) == 0x1E);                     //block 4 in slot 7
+
+  horizontal.drawLevel(1);
+
+  CHECK(display.emulator.ddram(0x00) == 4);
+
+  vertical.begin();
+
+  for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(i) == glyph[i]);}
+
+  CHECK(vertical.resolution() == 16);                               //length is limited by the 1-st row
+
+  CHECK(display.emulator.cgram((7 * 8) + 7) == 0x1F);               //block 7 in slot 7
+  CHECK(display.emulator.cgram((7 * 8) + 0) == 0x00);
+  CHECK(display.emulator.invalidAddresses == 0);
+}
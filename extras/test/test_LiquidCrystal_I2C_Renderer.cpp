@@ -0,0 +1,171 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Renderer tests, 16x2 display with framebuffer & emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - "loop()" is modeled by "tick()" every 1msec of virtual time, draw &
+     "flush()" move virtual time too
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Renderer.h>
+
+
+static uint32_t drawCalls;
+static uint32_t drawTime;                            //extra time spent in draw, in microseconds
+
+
+static void drawCounter(LiquidCrystal_I2C_Base &lcd)
+{
+  lcd.setCursor(0, 0);
+  lcd.print(++drawCalls);
+
+  hostTime += (uint64_t)drawTime * 1000;
+}
+
+
+static uint32_t runLoop(LiquidCrystal_I2C_Renderer &renderer, uint32_t milliseconds)
+{
+  uint32_t frames = 0;
+  uint64_t end    = hostTime + ((uint64_t)milliseconds * 1000000);
+
+  while (hostTime < end)
+  {
+    if (renderer.tick() == true) {frames++;}
+
+    hostTime += 1000000;
+  }
+
+  return frames;
+}
+
+
+TEST(rendererCapsRefreshRate)
+{
+  testDisplay                display;
+  uint8_t                    buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+  LiquidCrystal_I2C_Renderer renderer(display.lcd, drawCounter, 20);
+
+  display.begin();
+  display.lcd.enableFramebuffer(buffer, sizeof(buffer));
+
+  drawCalls = 0;
+  drawTime  = 0;
+
+  renderer.resetStats();
+
+  CHECK(runLoop(renderer, 1000) == 20);
+  CHECK(drawCalls == 20);
+
+  runLoop(renderer, 75);                                            //the 1-st frame of the next second updates fps
+
+  lcdRenderStats stats = renderer.getStats();
+
+  CHECK(stats.frames  == 22);
+  CHECK(stats.dropped == 0);
+  CHECK(stats.fps     == 20);
+  CHECK_TEXT("22", display.text(0, 0, 2));
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(rendererUpdatesFpsOnlyWhenRendering)
+{
+  testDisplay                display;
+  uint8_t                    buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+  LiquidCrystal_I2C_Renderer renderer(display.lcd, drawCounter, 10);
+
+  display.begin();
+  display.lcd.enableFramebuffer(buffer, sizeof(buffer));
+
+  drawCalls = 0;
+  drawTime  = 0;
+
+  renderer.resetStats();
+
+  runLoop(renderer, 1050);
+
+  CHECK(renderer.getStats().fps == 10);
+
+  hostTime += 3000000000ULL;                                        //3 seconds without "tick()"
+
+  CHECK(renderer.getStats().fps == 10);                             //nothing rendered, nothing measured
+
+  CHECK(renderer.tick() == true);
+
+  lcdRenderStats stats = renderer.getStats();
+
+  CHECK(stats.fps == 0);                                            //the last whole second was idle
+  CHECK(stats.dropped >= 29);                                       //missed frames are dropped, not sent later
+  CHECK(runLoop(renderer, 1000) == 10);                             //frames stay aligned to the refresh rate
+}
+
+
+TEST(rendererDropsLateFrames)
+{
+  testDisplay                display;
+  uint8_t                    buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+  LiquidCrystal_I2C_Renderer renderer(display.lcd, drawCounter, 10);
+
+  display.begin();
+  display.lcd.enableFramebuffer(buffer, sizeof(buffer));
+
+  drawCalls = 0;
+  drawTime  = 250000;                                               //250msec draw, 2.5 frames
+
+  renderer.resetStats();
+
+  uint32_t frames = runLoop(renderer, 1000);
+
+  lcdRenderStats stats = renderer.getStats();
+
+  CHECK(frames == stats.frames);
+  CHECK(frames <= 4);
+  CHECK(stats.dropped >= 4);
+  CHECK((frames + stats.dropped) >= 8);                             //every frame time is sent or dropped
+  CHECK(stats.worstFlushTime >= 250000);
+}
+
+
+TEST(rendererWaitsForQueue)
+{
+  testDisplay                display;
+  uint8_t                    buffer[LCD_FRAMEBUFFER_SIZE(16, 2)];
+  uint8_t                    queue[LCD_QUEUE_SIZE(64)];
+  LiquidCrystal_I2C_Renderer renderer(display.lcd, drawCounter, 10);
+
+  display.begin();
+  display.lcd.enableFramebuffer(buffer, sizeof(buffer));
+  display.lcd.enableQueue(queue, sizeof(queue));
+
+  drawCalls = 0;
+  drawTime  = 0;
+
+  CHECK(renderer.tick() == true);                                   //the 1-st frame goes to queue
+  CHECK(display.lcd.queueLength() != 0);
+
+  hostTime += 100000000;
+
+  CHECK(renderer.tick() == false);                                  //previous frame is still in queue
+  CHECK(renderer.getStats().dropped == 1);
+
+  while (display.lcd.tick(4) == true) {}
+
+  hostTime += 100000000;
+
+  CHECK(renderer.tick() == true);
+  CHECK(drawCalls == 2);
+
+  display.lcd.disableQueue();
+
+  CHECK_TEXT("2", display.text(0, 0, 1));
+}
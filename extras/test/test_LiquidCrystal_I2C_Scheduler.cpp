@@ -0,0 +1,177 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Scheduler tests, three 16x2 displays with emulators on one bus
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - "orderedLcd" is emulator which records the order in which
+     displays receive I2C transactions
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Scheduler.h>
+
+#define SCHEDULER_DISPLAYS 3
+
+
+static std::vector<uint8_t> busOrder;                //display of every transaction, consecutive bytes of one display are one entry
+
+
+class orderedLcd : public LcdEmulator
+{
+  public:
+   orderedLcd(uint8_t id) : _id(id) {}
+
+   void onWrite(uint8_t value, uint64_t time)
+   {
+     if (busOrder.empty() || (busOrder.back() != _id)) {busOrder.push_back(_id);}
+
+     LcdEmulator::onWrite(value, time);
+   }
+
+  private:
+   uint8_t _id;
+};
+
+
+class schedulerBus
+{
+  public:
+   schedulerBus()
+   {
+     for (uint8_t i = 0; i < SCHEDULER_DISPLAYS; i++)
+     {
+       emulator[i] = new orderedLcd(i);
+       lcd[i]      = new LiquidCrystal_I2C(address[i]);
+
+       Wire.attach(address[i], emulator[i]);
+     }
+
+     Wire.setClock(LCD_I2C_SPEED);
+   }
+
+  ~schedulerBus()
+   {
+     for (uint8_t i = 0; i < SCHEDULER_DISPLAYS; i++)
+     {
+       Wire.attach(address[i], NULL);
+
+       delete lcd[i];
+       delete emulator[i];
+     }
+   }
+
+   void begin(LiquidCrystal_I2C_Scheduler &scheduler)
+   {
+     for (uint8_t i = 0; i < SCHEDULER_DISPLAYS; i++)
+     {
+       lcd[i]->begin(16, 2);
+       lcd[i]->enableQueue(queue[i], sizeof(queue[i]));
+
+       scheduler.add(*lcd[i]);
+     }
+
+     busOrder.clear();
+   }
+
+   static constexpr pcf8574Address address[SCHEDULER_DISPLAYS] = {PCF8574_ADDR_A21_A11_A01, PCF8574_ADDR_A21_A11_A00, PCF8574_ADDR_A21_A10_A01};
+
+   orderedLcd        *emulator[SCHEDULER_DISPLAYS];
+   LiquidCrystal_I2C *lcd[SCHEDULER_DISPLAYS];
+   uint8_t            queue[SCHEDULER_DISPLAYS][LCD_QUEUE_SIZE(32)];
+};
+
+
+TEST(schedulerRoundRobin)
+{
+  schedulerBus                bus;
+  LiquidCrystal_I2C_Scheduler scheduler;
+
+  bus.begin(scheduler);
+
+  for (uint8_t i = 0; i < SCHEDULER_DISPLAYS; i++) {bus.lcd[i]->print("0123456789");}
+
+  for (uint8_t round = 0; round < 4; round++)
+  {
+    busOrder.clear();
+
+    hostTime += 100000;                                             //every LCD is ready
+
+    CHECK(scheduler.tick(1) == true);
+    CHECK(busOrder.size() == SCHEDULER_DISPLAYS);                   //one transaction per LCD
+
+    for (uint8_t i = 0; (i < SCHEDULER_DISPLAYS) && (i < busOrder.size()); i++) {CHECK(busOrder[i] == ((round + i) % SCHEDULER_DISPLAYS));} //the first LCD moves every call
+  }
+
+  CHECK(scheduler.queueLength() == SCHEDULER_DISPLAYS * (10 - 4));
+
+  scheduler.flush();
+
+  CHECK(scheduler.queueLength() == 0);
+
+  for (uint8_t i = 0; i < SCHEDULER_DISPLAYS; i++)
+  {
+    CHECK_TEXT("0123456789", bus.emulator[i]->text(0, 0, 10));
+    CHECK(bus.emulator[i]->violations == 0);
+  }
+}
+
+
+TEST(schedulerSkipsBusyLcd)
+{
+  schedulerBus                bus;
+  LiquidCrystal_I2C_Scheduler scheduler;
+
+  bus.begin(scheduler);
+
+  bus.lcd[0]->clear();
+  bus.lcd[0]->print("A");
+  bus.lcd[1]->print("BBBB");
+  bus.lcd[2]->print("CCCC");
+
+  hostTime += 100000;
+
+  scheduler.tick(1);                                                //LCD 0 starts "clear()"
+
+  busOrder.clear();
+
+  hostTime += 50000;                                                //50usec, LCD 1 & 2 are ready, "clear()" takes 2msec
+
+  scheduler.tick(1);
+
+  CHECK(busOrder.size() == 2);                                      //LCD 0 is clearing & doesn't stop the others
+  CHECK(std::count(busOrder.begin(), busOrder.end(), 0) == 0);
+
+  CHECK(bus.lcd[0]->queueLength() == 1);
+  CHECK(bus.lcd[1]->queueLength() == 2);
+  CHECK(bus.lcd[2]->queueLength() == 2);
+
+  scheduler.flush();
+
+  CHECK_TEXT("A   ", bus.emulator[0]->text(0, 0, 4));
+  CHECK_TEXT("BBBB", bus.emulator[1]->text(0, 0, 4));
+  CHECK(bus.emulator[0]->violations == 0);
+}
+
+
+TEST(schedulerAddsUpToEightLcd)
+{
+  LiquidCrystal_I2C_Scheduler scheduler;
+  LiquidCrystal_I2C           lcd;
+
+  for (uint8_t i = 0; i < LCD_SCHEDULER_MAX_DISPLAYS; i++) {CHECK(scheduler.add(lcd) == true);}
+
+  CHECK(scheduler.add(lcd) == false);
+  CHECK(scheduler.tick() == false);                                 //queue isn't enabled
+}
@@ -0,0 +1,145 @@
+/***************************************************************************************************/
+/*
+   LiquidCrystal_I2C_Sparkline tests, 16x2 display with emulator
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - dot column "x" of the cell is bit "0x10 >> x", pixel "p" is CGRAM
+     row "7 - p"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+#include <LiquidCrystal_I2C_Sparkline.h>
+
+
+TEST(sparklinePrintsChartOnce)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Sparkline chart(display.lcd, 4, 1, 3, 2);
+
+  display.begin();
+  chart.begin();
+
+  CHECK(display.emulator.ddram(0x44) == 2);
+  CHECK(display.emulator.ddram(0x45) == 3);
+  CHECK(display.emulator.ddram(0x46) == 4);
+
+  for (uint8_t i = 0; i < 3 * 8; i++) {CHECK(display.emulator.cgram(16 + i) == 0x00);}
+
+  uint32_t commands = display.emulator.commands;
+
+  chart.push(1023);
+
+  CHECK(display.emulator.cgram(16 + (2 * 8)) == 0x01);              //newest sample is the rightmost dot at the top
+  CHECK(display.emulator.ddram(0x46) == 4);
+  CHECK(display.emulator.commands - commands == 1);                 //CGRAM address only, chart characters aren't reprinted
+  CHECK(display.emulator.violations == 0);
+}
+
+
+TEST(sparklineScrollsLeft)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Sparkline chart(display.lcd, 0, 0, 2);
+
+  display.begin();
+  chart.begin();
+
+  chart.push(0);
+  chart.push(1023);
+
+  CHECK(display.emulator.cgram(8 + 7) == 0x02);                     //older sample at the bottom, one dot to the left
+  CHECK(display.emulator.cgram(8 + 0) == 0x01);
+
+  for (uint8_t i = 0; i < 5; i++) {chart.push(1023);}
+
+  CHECK(display.emulator.cgram(8 + 7) == 0x00);
+  CHECK(display.emulator.cgram(0 + 7) == 0x02);                     //moved to the 1-st cell
+}
+
+
+TEST(sparklineFlatSignalSendsNothing)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Sparkline chart(display.lcd, 0, 0, 4);
+
+  display.begin();
+  chart.begin();
+
+  for (uint8_t i = 0; i < 4 * LCD_SPARKLINE_WIDTH; i++) {chart.push(512);}
+
+  uint32_t characters = display.emulator.characters;
+
+  chart.push(512);                                                  //full history, the same frame
+
+  CHECK(display.emulator.characters == characters);
+
+  for (uint8_t cell = 0; cell < 4; cell++) {CHECK(display.emulator.cgram((cell * 8) + 3) == 0x1F);}
+
+  chart.clear();
+
+  for (uint8_t cell = 0; cell < 4; cell++) {CHECK(display.emulator.cgram((cell * 8) + 3) == 0x00);}
+}
+
+
+TEST(sparklineFullInt16Range)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Sparkline chart(display.lcd, 0, 0, 1);
+
+  display.begin();
+  chart.begin();
+
+  chart.setRange(-32768, 32767);                                    //"value - minValue" & "maxValue - minValue" overflow 16-bit "int"
+
+  chart.push(32767);
+  chart.push(-32768);
+  chart.push(0);
+
+  CHECK(display.emulator.cgram(0) == 0x04);                         //maximum at the top
+  CHECK(display.emulator.cgram(7) == 0x02);                         //minimum at the bottom
+  CHECK(display.emulator.cgram(3) == 0x01);                         //middle, 3.5 pixels rounded up
+
+  for (uint8_t row = 0; row < 8; row++)
+  {
+    if ((row != 0) && (row != 3) && (row != 7)) {CHECK(display.emulator.cgram(row) == 0x00);}
+  }
+}
+
+
+TEST(sparklineRangeAndSlots)
+{
+  testDisplay                 display;
+  LiquidCrystal_I2C_Sparkline chart(display.lcd, 0, 0, 5, 6);      //2 slots left after slot 6
+  uint8_t                     glyph[8] = {0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A, 0x15, 0x0A};
+
+  display.begin();
+
+  display.lcd.createChar(5, glyph);
+
+  chart.begin();
+
+  CHECK(display.emulator.ddram(0x00) == 6);
+  CHECK(display.emulator.ddram(0x01) == 7);
+  CHECK(display.emulator.ddram(0x02) == ' ');
+
+  for (uint8_t i = 0; i < 8; i++) {CHECK(display.emulator.cgram(40 + i) == glyph[i]);}
+
+  chart.setRange(100, 100);                                         //ignored, range stays 0..1023
+  chart.setRange(10, 20);
+
+  chart.push(5);                                                    //below minimum
+  chart.push(25);                                                   //above maximum
+
+  CHECK(display.emulator.cgram(56 + 7) == 0x02);
+  CHECK(display.emulator.cgram(56 + 0) == 0x01);
+  CHECK(display.emulator.invalidAddresses == 0);
+}
@@ -0,0 +1,49 @@
+/***************************************************************************************************/
+/*
+   Test runner of LiquidCrystal_I2C test harness
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - optional argument runs only test cases with this text in name
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "test.h"
+
+testCase *testCase::first = NULL;
+
+
+testCase::testCase(const char *caseName, testFunction caseFunction) : name(caseName), function(caseFunction), next(first)
+{
+  first = this;
+}
+
+
+int main(int argc, char **argv)
+{
+  uint16_t total  = 0;
+  uint16_t failed = 0;
+
+  for (testCase *test = testCase::first; test != NULL; test = test->next)
+  {
+    if ((argc > 1) && (strstr(test->name, argv[1]) == NULL)) {continue;}
+
+    bool result = false;
+
+    test->function(result);
+
+    total++;
+
+    if (result == true) {failed++; printf("FAIL %s\n", test->name);}
+  }
+
+  printf("%u tests, %u failed\n", total, failed);
+
+  return (failed == 0) ? 0 : 1;
+}
@@ -48,6 +48,38 @@
 #include "LiquidCrystal_I2C.h"
 
 
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Base()
+
+    Constructor. Initializes class variables, defines I2C address &
+    backlight polarity
+
+    NOTE:
+    - LCD pins to PCF8574 ports mapping & backlight value are set by
+      derived class, virtual "_backlightPort()" can't be called here
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Base::LiquidCrystal_I2C_Base(pcf8574Address addr, backlightPolarity polarity)
+{
+  _pcf8574Address    = addr;
+  _backlightPolarity = polarity;
+}
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Base()
+
+    Constructor. Same as above, for LCD on any I2C bus
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Base::LiquidCrystal_I2C_Base(LiquidCrystal_I2C_Bus &bus, pcf8574Address addr, backlightPolarity polarity) : LiquidCrystal_I2C_Base(addr, polarity)
+{
+  _bus = &bus;
+}
+
+
 /**************************************************************************/
 /*
     LiquidCrystal_I2C()
@@ -56,14 +88,48 @@
     LCD & PCF8574 pins
 */
 /**************************************************************************/  
-LiquidCrystal_I2C::LiquidCrystal_I2C(pcf8574Address addr, uint8_t P0, uint8_t P1, uint8_t P2, uint8_t P3, uint8_t P4, uint8_t P5, uint8_t P6, uint8_t P7, backlightPolarity polarity)
+#if defined (ARDUINO)
+LiquidCrystal_I2C::LiquidCrystal_I2C(pcf8574Address addr, uint8_t P0, uint8_t P1, uint8_t P2, uint8_t P3, uint8_t P4, uint8_t P5, uint8_t P6, uint8_t P7, backlightPolarity polarity) : LiquidCrystal_I2C_Base(addr, polarity)
+{
+  uint8_t pcf8574ToLCD[8] = {P0, P1, P2, P3, P4, P5, P6, P7}; //PCF8574 ports to LCD pins mapping array
+
+  _portsInitialization(pcf8574ToLCD);
+}
+#endif
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C()
+
+    Constructor. Same as above, for LCD on any I2C bus
+
+    NOTE:
+    - bus backends:
+      - LiquidCrystal_I2C_TwoWire, for Arduino Wire1, Wire2 & etc.
+      - LiquidCrystal_I2C_LinuxI2C, for Linux "/dev/i2c-N"
+
+    - bus must be started before "begin()", see backend for details
+*/
+/**************************************************************************/
+LiquidCrystal_I2C::LiquidCrystal_I2C(LiquidCrystal_I2C_Bus &bus, pcf8574Address addr, uint8_t P0, uint8_t P1, uint8_t P2, uint8_t P3, uint8_t P4, uint8_t P5, uint8_t P6, uint8_t P7, backlightPolarity polarity) : LiquidCrystal_I2C_Base(bus, addr, polarity)
 {
   uint8_t pcf8574ToLCD[8] = {P0, P1, P2, P3, P4, P5, P6, P7}; //PCF8574 ports to LCD pins mapping array
 
-  _pcf8574Address     = addr;
-  _backlightPolarity  = polarity;
-  _pcf8574PortsMaping = true;
+  _portsInitialization(pcf8574ToLCD);
+}
+
+
+/**************************************************************************/
+/*
+    _portsInitialization()
 
+    Maps LCD pins to PCF8574 ports, sets backlight value & builds PCF8574
+    ports lookup tables
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C::_portsInitialization(const uint8_t *pcf8574ToLCD)
+{
   /* maping LCD pins to PCF8574 ports */
   for (uint8_t i = 0; i < 8; i++)
   {
@@ -108,18 +174,22 @@ LiquidCrystal_I2C::LiquidCrystal_I2C(pcf8574Address addr, uint8_t P0, uint8_t P1
   }
 
   /* backlight control via PCF8574 */
-  switch (_backlightPolarity)
+  _setBacklight(LCD_BACKLIGHT_ON);
+
+  if (_pcf8574PortsMaping == false) {return;}
+
+  /* LCD data nibbles & modes to PCF8574 ports lookup tables, see "_encode()" */
+  for (uint8_t i = 0; i < 16; i++)
   {
-    case POSITIVE:
-      _backlightValue = LCD_BACKLIGHT_ON;
-      break;
+    _nibbleToPCF8574[i] = _portMapping(i << 1); //0,0,0,DB7,DB6,DB5,DB4,BCK_LED=0
+  }
 
-    case NEGATIVE:
-      _backlightValue = ~LCD_BACKLIGHT_ON;
-      break;
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    _modeToPCF8574[i]   = _portMapping(i << 5); //RS,RW,E,0,0,0,0,BCK_LED=0
   }
 
-  _backlightValue <<= _lcdToPCF8574[0];
+  _enPCF8574 = _modeToPCF8574[LCD_INSTRUCTION_WRITE >> 5]; //0,0,E=1,0,0,0,0,BCK_LED=0
 }
 
 /**************************************************************************/
@@ -129,6 +199,15 @@ LiquidCrystal_I2C::LiquidCrystal_I2C(pcf8574Address addr, uint8_t P0, uint8_t P1
     Initialize I2C bus, resets & configures LCD
 
     NOTE:
+    - I2C speed is used to pack several characters into one I2C transaction,
+      set it here & not with "Wire.setClock()" after "begin()"
+
+    - global "Wire" is started here, any other bus must be started before,
+      see "LiquidCrystal_I2C(LiquidCrystal_I2C_Bus &bus, ...)"
+
+    - without Arduino core, e.g. Linux, "speed" is passed to bus backend,
+      see "LiquidCrystal_I2C_LinuxI2C"
+
     - returned value by "Wire.endTransmission()":
       - 0, success
       - 1, data too long to fit in transmit data buffer
@@ -138,57 +217,86 @@ LiquidCrystal_I2C::LiquidCrystal_I2C(pcf8574Address addr, uint8_t P0, uint8_t P1
 */
 /**************************************************************************/
 #if defined (ARDUINO_ARCH_AVR)
-bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t speed, uint32_t stretch)
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t speed, uint32_t stretch)
 {
-  Wire.begin();
+  if (_bus == &lcdDefaultBus)
+  {
+    Wire.begin();
 
-  Wire.setClock(speed);                                    //experimental! AVR I2C bus speed 31kHz..400kHz, default 100000Hz
+    Wire.setClock(speed);                                    //experimental! AVR I2C bus speed 31kHz..400kHz, default 100000Hz
 
-  #if !defined (__AVR_ATtiny85__)                          //for backwards compatibility with ATtiny Core
-  Wire.setWireTimeout(stretch, false);                     //experimental! default 25000usec, true=Wire hardware will be automatically reset to default on timeout
-  #endif
+    #if !defined (__AVR_ATtiny85__)                          //for backwards compatibility with ATtiny Core
+    Wire.setWireTimeout(stretch, false);                     //experimental! default 25000usec, true=Wire hardware will be automatically reset to default on timeout
+    #endif
+  }
 
 #elif defined (ARDUINO_ARCH_ESP8266)
-bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint8_t sda, uint8_t scl, uint32_t speed, uint32_t stretch)
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint8_t sda, uint8_t scl, uint32_t speed, uint32_t stretch)
 {
-  Wire.begin(sda, scl);
+  if (_bus == &lcdDefaultBus)
+  {
+    Wire.begin(sda, scl);
 
-  Wire.setClock(speed);                                    //experimental! ESP8266 I2C bus speed 1kHz..400kHz, default 100000Hz
+    Wire.setClock(speed);                                    //experimental! ESP8266 I2C bus speed 1kHz..400kHz, default 100000Hz
 
-  Wire.setClockStretchLimit(stretch);                      //experimental! default 150000usec
+    Wire.setClockStretchLimit(stretch);                      //experimental! default 150000usec
+  }
 
 #elif defined (ARDUINO_ARCH_ESP32)
-bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, int32_t sda, int32_t scl, uint32_t speed, uint32_t stretch) //"int32_t" for Master SDA & SCL, "uint8_t" for Slave SDA & SCL
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, int32_t sda, int32_t scl, uint32_t speed, uint32_t stretch) //"int32_t" for Master SDA & SCL, "uint8_t" for Slave SDA & SCL
 {
-  if (Wire.begin(sda, scl, speed) != true) {return false;} //experimental! ESP32 I2C bus speed ???kHz..400kHz, default 100000Hz
+  if (_bus == &lcdDefaultBus)
+  {
+    if (Wire.begin(sda, scl, speed) != true) {return false;} //experimental! ESP32 I2C bus speed ???kHz..400kHz, default 100000Hz
 
-  Wire.setTimeout(stretch / 1000);                         //experimental! default 50msec
+    Wire.setTimeout(stretch / 1000);                         //experimental! default 50msec
+  }
 
 #elif defined (ARDUINO_ARCH_STM32)
-bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t sda, uint32_t scl, uint32_t speed) //"uint32_t" for pins only, "uint8_t" calls wrong "setSCL(PinName scl)"
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t sda, uint32_t scl, uint32_t speed) //"uint32_t" for pins only, "uint8_t" calls wrong "setSCL(PinName scl)"
 {
-  Wire.begin(sda, scl);
+  if (_bus == &lcdDefaultBus)
+  {
+    Wire.begin(sda, scl);
 
-  Wire.setClock(speed);                                    //experimental! STM32 I2C bus speed ???kHz..400kHz, default 100000Hz
+    Wire.setClock(speed);                                    //experimental! STM32 I2C bus speed ???kHz..400kHz, default 100000Hz
+  }
 
 #elif defined (ARDUINO_ARCH_SAMD)
-bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t speed)
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t speed)
+{
+  if (_bus == &lcdDefaultBus)
+  {
+    Wire.begin();
+
+    Wire.setClock(speed);                                    //experimental! SAMD21 I2C bus speed ???kHz..400kHz, default 100000Hz
+  }
+
+#elif defined (ARDUINO)
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize)
 {
-  Wire.begin();
+  uint32_t speed = LCD_I2C_SPEED;                          //unknown core, "wire.h" runs at default speed
 
-  Wire.setClock(speed);                                    //experimental! SAMD21 I2C bus speed ???kHz..400kHz, default 100000Hz
+  if (_bus == &lcdDefaultBus) {Wire.begin();}
 
 #else
-bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize)
+bool LiquidCrystal_I2C_Base::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSize, uint32_t speed)
 {
-  Wire.begin();
+  if (_bus->begin(speed) != true) {return false;}          //no Arduino core & "Wire", Linux or host bus only, see "extras/linux"
+#endif
+
+#if defined (ARDUINO)
+  if ((_bus != &lcdDefaultBus) && (_bus->begin(speed) != true)) {return false;} //user bus, started by user, see "LiquidCrystal_I2C_Bus"
 #endif
 
   if (_pcf8574PortsMaping == false) {return false;}        //safety check, make sure lcd pins declaration is right
 
-  Wire.beginTransmission(_pcf8574Address);
+  _queue       = NULL;                                     //LCD initialized with blocking delays, queued commands dropped
+  _framebuffer = NULL;
 
-  if (Wire.endTransmission() != 0) {return false;}         //safety check, make sure the PCF8574 is connected
+  resetStats();
+
+  if (_bus->write(_pcf8574Address, NULL, 0) != 0) {return false;} //safety check, make sure the PCF8574 is connected
 
   _writePCF8574(PCF8574_PORTS_LOW);                        //safety, set all PCF8574 pins low
 
@@ -196,8 +304,18 @@ bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSiz
   _lcdRows     = rows;
   _lcdFontSize = fontSize;
 
+  _i2cSpeed = speed;
+
+  _setTiming(LCD_COMMAND_DELAY, LCD_HOME_CLEAR_DELAY * 1000); //datasheet worst case
+
+  _busCommandTime = (1 + (3 * LCD_I2C_BIT_PER_BYTE)) * (1000000UL / speed); //START, address, E=1 & E=0 bytes of the next command, in usec
+
   _initialization();                                       //soft reset LCD & 4-bit mode initialization
 
+  if ((_beginOptions & LCD_BEGIN_TUNE_SPEED) != 0) {tuneSpeed();}    //keeps "begin()" speed if LCD can't be read, before calibration, padding depends on speed
+
+  if ((_beginOptions & LCD_BEGIN_CALIBRATE) != 0) {calibrateTiming();} //keeps datasheet timing if LCD can't be measured
+
   return true;
 }
 
@@ -211,14 +329,26 @@ bool LiquidCrystal_I2C::begin(uint8_t columns, uint8_t rows, lcdFontSize fontSiz
     NOTE:
     - fills display with spaces
     - moves cursor to home position (0, 0)
+    - sets "leftToRight()" mode
     - command duration > 1.53msec..1.64msec
+    - with framebuffer only fills framebuffer with spaces, no delay
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::clear()
+void LiquidCrystal_I2C_Base::clear()
 {
+  if (_framebuffer != NULL)                                      //fills framebuffer with spaces, see "flush()"
+  {
+    memset(_framebuffer, LCD_SPACE_SYMBOL, (uint16_t)_lcdColumns * _lcdRows);
+
+    _cursorColumn = 0;
+    _cursorRow    = 0;
+
+    return;
+  }
+
   _send(LCD_INSTRUCTION_WRITE, LCD_CLEAR_DISPLAY, LCD_CMD_LENGTH_8BIT);
 
-  delay(LCD_HOME_CLEAR_DELAY);
+  _wait(_homeClearDelay);
 }
 
 
@@ -232,13 +362,23 @@ void LiquidCrystal_I2C::clear()
     - sets DDRAM address to 0 in address counter, returns display to
       home position, but DDRAM contents remain unchanged
     - command duration > 1.53msec..1.64msec
+    - with framebuffer only moves framebuffer cursor, display shift
+      stays unchanged
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::home()
+void LiquidCrystal_I2C_Base::home()
 {
+  if (_framebuffer != NULL)                                      //moves framebuffer cursor only
+  {
+    _cursorColumn = 0;
+    _cursorRow    = 0;
+
+    return;
+  }
+
   _send(LCD_INSTRUCTION_WRITE, LCD_RETURN_HOME, LCD_CMD_LENGTH_8BIT);
 
-  delay(LCD_HOME_CLEAR_DELAY);
+  _wait(_homeClearDelay);
 }
 
 
@@ -251,16 +391,24 @@ void LiquidCrystal_I2C::home()
     NOTE:
     - cursor position range (0, 0)..(column - 1, row - 1)
     - DDRAM data/text is sent & received after this setting
+    - nothing is sent if address counter already points to this
+      position, e.g. right after "print()" of the previous field
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::setCursor(uint8_t column, uint8_t row)
+void LiquidCrystal_I2C_Base::setCursor(uint8_t column, uint8_t row)
 {
-  uint8_t rowAddressOffset[4] = {0x00, 0x40, (uint8_t)(_lcdColumns + 0x00), (uint8_t)(_lcdColumns + 0x40)};
-
   column = constrain(column, 0, (_lcdColumns - 1)); //check column value range, see NOTE
   row    = constrain(row,    0, (_lcdRows    - 1)); //check row value range, see NOTE
 
-  _send(LCD_INSTRUCTION_WRITE, (LCD_DDRAM_ADDR_SET | (rowAddressOffset[row] + column)), LCD_CMD_LENGTH_8BIT);
+  if (_framebuffer != NULL)                         //moves framebuffer cursor only
+  {
+    _cursorColumn = column;
+    _cursorRow    = row;
+
+    return;
+  }
+
+  _setAddress(_ddramAddress(column, row));
 }
 
 
@@ -274,7 +422,7 @@ void LiquidCrystal_I2C::setCursor(uint8_t column, uint8_t row)
     - text remains in DDRAM
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::noDisplay()
+void LiquidCrystal_I2C_Base::noDisplay()
 {
   _displayControl &= ~LCD_DISPLAY_ON;
 
@@ -292,7 +440,7 @@ void LiquidCrystal_I2C::noDisplay()
     - text remains in DDRAM
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::display()
+void LiquidCrystal_I2C_Base::display()
 {
   _displayControl |= LCD_DISPLAY_ON;
 
@@ -307,7 +455,7 @@ void LiquidCrystal_I2C::display()
     Turns OFF underline cursor
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::noCursor()
+void LiquidCrystal_I2C_Base::noCursor()
 {
   _displayControl &= ~LCD_UNDERLINE_CURSOR_ON;
 
@@ -322,7 +470,7 @@ void LiquidCrystal_I2C::noCursor()
     Turns ON underline cursor
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::cursor()
+void LiquidCrystal_I2C_Base::cursor()
 {
   _displayControl |= LCD_UNDERLINE_CURSOR_ON;
 
@@ -337,7 +485,7 @@ void LiquidCrystal_I2C::cursor()
     Turns OFF blinking cursor
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::noBlink()
+void LiquidCrystal_I2C_Base::noBlink()
 {
   _displayControl &= ~LCD_BLINK_CURSOR_ON;
 
@@ -352,7 +500,7 @@ void LiquidCrystal_I2C::noBlink()
     Turns ON blinking cursor
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::blink()
+void LiquidCrystal_I2C_Base::blink()
 {
   _displayControl |= LCD_BLINK_CURSOR_ON;
 
@@ -371,7 +519,7 @@ void LiquidCrystal_I2C::blink()
     - text grows from cursor to the left
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::scrollDisplayLeft()
+void LiquidCrystal_I2C_Base::scrollDisplayLeft()
 {
   _send(LCD_INSTRUCTION_WRITE, (LCD_CURSOR_DISPLAY_SHIFT | LCD_DISPLAY_SHIFT | LCD_SHIFT_LEFT), LCD_CMD_LENGTH_8BIT);
 }
@@ -387,7 +535,7 @@ void LiquidCrystal_I2C::scrollDisplayLeft()
     - text & cursor grows together to the left from cursor position
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::scrollDisplayRight()
+void LiquidCrystal_I2C_Base::scrollDisplayRight()
 {
   _send(LCD_INSTRUCTION_WRITE, (LCD_CURSOR_DISPLAY_SHIFT | LCD_DISPLAY_SHIFT | LCD_SHIFT_RIGHT), LCD_CMD_LENGTH_8BIT);
 }
@@ -399,7 +547,7 @@ void LiquidCrystal_I2C::scrollDisplayRight()
     Sets text direction from left to right
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::leftToRight()
+void LiquidCrystal_I2C_Base::leftToRight()
 {
   _displayMode |= LCD_ENTRY_LEFT;
 
@@ -413,7 +561,7 @@ void LiquidCrystal_I2C::leftToRight()
     Sets text direction from right to left
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::rightToLeft()
+void LiquidCrystal_I2C_Base::rightToLeft()
 {
   _displayMode &= ~LCD_ENTRY_LEFT;
 
@@ -432,7 +580,7 @@ void LiquidCrystal_I2C::rightToLeft()
       to call it the "loop()", just call it once in "setup()"
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::autoscroll() 
+void LiquidCrystal_I2C_Base::autoscroll() 
 {
   _displayMode |= LCD_ENTRY_SHIFT_ON;
 
@@ -450,7 +598,7 @@ void LiquidCrystal_I2C::autoscroll()
     - whole text on the display stays, cursor shifts when byte written
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::noAutoscroll()
+void LiquidCrystal_I2C_Base::noAutoscroll()
 {
   _displayMode &= ~LCD_ENTRY_SHIFT_ON;
 
@@ -472,6 +620,9 @@ void LiquidCrystal_I2C::noAutoscroll()
         or
         "createChar(address, myChar, (sizeof(myChar) / sizeof(uint8_t)))"
 
+    - all characters on the screen with this code change at once, the
+      next "write()" or "print()" continues at previous DDRAM address
+
     - 5x8DOTS display:
       - 8 custom characters (patterns)
       - 5-pixels x 8-rows characters size 
@@ -491,7 +642,7 @@ void LiquidCrystal_I2C::noAutoscroll()
         return sizeof(arr[0]);             //2
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::createChar(uint8_t cgramAddress, uint8_t *cgramChar, uint8_t cgramCharSize)
+void LiquidCrystal_I2C_Base::createChar(uint8_t cgramAddress, uint8_t *cgramChar, uint8_t cgramCharSize)
 {
   switch (_lcdFontSize)
   {
@@ -508,10 +659,9 @@ void LiquidCrystal_I2C::createChar(uint8_t cgramAddress, uint8_t *cgramChar, uin
 
   _send(LCD_INSTRUCTION_WRITE, (LCD_CGRAM_ADDR_SET | (cgramAddress << 3)), LCD_CMD_LENGTH_8BIT); //set custom character CGRAM address
 
-  for (uint8_t i = 0; i < cgramCharSize; i++)                                                    //write custom character row by row 
-  {
-    _send(LCD_DATA_WRITE, cgramChar[i], LCD_CMD_LENGTH_8BIT);                                    //write row from MCU RAM to CGRAM address
-  }
+  _sendData(cgramChar, cgramCharSize, false);                                                    //write custom character rows from MCU RAM to CGRAM address
+
+  _restoreAddress(true);                                                                         //move visible cursor back, see "_restoreAddress()"
 }
 
 
@@ -526,7 +676,7 @@ void LiquidCrystal_I2C::createChar(uint8_t cgramAddress, uint8_t *cgramChar, uin
 */
 /**************************************************************************/
 #if defined (PROGMEM)
-void LiquidCrystal_I2C::createChar(uint8_t cgramAddress, const uint8_t *cgramChar, uint8_t cgramCharSize)
+void LiquidCrystal_I2C_Base::createChar(uint8_t cgramAddress, const uint8_t *cgramChar, uint8_t cgramCharSize)
 {
   switch (_lcdFontSize)
   {
@@ -543,270 +693,1140 @@ void LiquidCrystal_I2C::createChar(uint8_t cgramAddress, const uint8_t *cgramCha
 
   _send(LCD_INSTRUCTION_WRITE, (LCD_CGRAM_ADDR_SET | (cgramAddress << 3)), LCD_CMD_LENGTH_8BIT); //set custom character CGRAM address
 
-  for (uint8_t i = 0; i < cgramCharSize; i++)                                                    //write custom character row by row 
-  {
-    _send(LCD_DATA_WRITE, pgm_read_byte(&cgramChar[i]), LCD_CMD_LENGTH_8BIT);                    //write row from MCU flash memory to LCD CGRAM address
-  }
+  _sendData(cgramChar, cgramCharSize, true);                                                     //write custom character rows from MCU flash memory to CGRAM address
+
+  _restoreAddress(true);                                                                         //move visible cursor back, see "_restoreAddress()"
 }
 #endif
 
 
 /**************************************************************************/
 /*
-    noBacklight()
+    writeCGRAM()
 
-    Turns off the backlight via PCF8574
+    Writes rows of custom characters from MCU dynamic memory to 64-bytes
+    CGRAM, starting from any row
 
     NOTE:
-    - doesn't affect LCD controller, because we are working with
-      transistor conncted to PCF8574 port
+    - "cgramRow" is CGRAM address 0..63, custom character "n" row "r"
+      address is "n * 8 + r", CGRAM address increments after every row
+      so one call may update the end of one character & the beginning
+      of the next one
+
+    - unlike "createChar()" only changed rows need to be sent, useful
+      for animations & charts
+
+    - the next "write()" or "print()" continues at DDRAM address used
+      before CGRAM write, user cursor isn't disturbed
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::noBacklight()
+void LiquidCrystal_I2C_Base::writeCGRAM(uint8_t cgramRow, const uint8_t *rows, uint8_t size)
 {
-  switch (_backlightPolarity)
-  {
-    case POSITIVE:
-      _backlightValue = LCD_BACKLIGHT_OFF;
-      break;
+  cgramRow &= 0x3F;                                                                    //check CGRAM address range, 64-bytes
 
-    case NEGATIVE:
-      _backlightValue = ~LCD_BACKLIGHT_OFF;
-      break;
-  }
+  if (size > (64 - cgramRow)) {size = 64 - cgramRow;}                                  //safety check, CGRAM address wraps to 0 after 63
 
-  _backlightValue <<= _lcdToPCF8574[0];
+  _send(LCD_INSTRUCTION_WRITE, (LCD_CGRAM_ADDR_SET | cgramRow), LCD_CMD_LENGTH_8BIT); //set CGRAM address
 
-  _writePCF8574(PCF8574_PORTS_LOW);
+  _sendData(rows, size, false);                                                        //write rows from MCU RAM to CGRAM address
+
+  _restoreAddress(true);                                                               //move visible cursor back, see "_restoreAddress()"
 }
 
 
 /**************************************************************************/
 /*
-    backlight()
+    writeDDRAM()
 
-    Turns on backlight via PCF8574
+    Writes characters from MCU dynamic memory to 80-bytes DDRAM, starting
+    from any DDRAM address
 
     NOTE:
-    - see "noBacklight()" for details
+    - "ddramAddress" is 0x00..0x27 for the 1-st line & 0x40..0x67 for
+      the 2-nd line, unlike "setCursor()" it can reach characters
+      outside of the screen, useful with "scrollDisplayLeft()"
+
+    - DDRAM address increments after every character, 2-lines display
+      jumps from 0x27 to 0x40 & from 0x67 to 0x00
+
+    - framebuffer is bypassed & not updated
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::backlight()
+void LiquidCrystal_I2C_Base::writeDDRAM(uint8_t ddramAddress, const uint8_t *data, uint8_t size)
 {
-  switch (_backlightPolarity)
-  {
-    case POSITIVE:
-      _backlightValue = LCD_BACKLIGHT_ON;
-      break;
-
-    case NEGATIVE:
-      _backlightValue = ~LCD_BACKLIGHT_ON;
-      break;
-  }
+  _setAddress(ddramAddress & 0x7F);  //set DDRAM address
 
-  _backlightValue <<= _lcdToPCF8574[0];
-
-  _writePCF8574(PCF8574_PORTS_LOW);
+  _sendData(data, size, false);      //write characters from MCU RAM to DDRAM address
 }
 
 
 /**************************************************************************/
 /*
-    write()
+    noBacklight()
 
-    Sends character to LCD
+    Turns off the backlight via PCF8574
 
     NOTE:
-    - replacement for Arduino "write()" in class "Print"
+    - doesn't affect LCD controller, because we are working with
+      transistor conncted to PCF8574 port
 */
 /**************************************************************************/
-size_t LiquidCrystal_I2C::write(uint8_t character)
+void LiquidCrystal_I2C_Base::noBacklight()
 {
-  _send(LCD_DATA_WRITE, character, LCD_CMD_LENGTH_8BIT);
+  _setBacklight(LCD_BACKLIGHT_OFF);
 
-  return 1;
+  _writePCF8574(PCF8574_PORTS_LOW);
 }
 
 
 /**************************************************************************/
 /*
-    _initialization()
+    backlight()
 
-    Soft reset LCD & activate 4-bit interface
+    Turns on backlight via PCF8574
 
     NOTE:
-    - for correct LCD operation it is necessary to do the internal circuit
-      reset & initialization procedure
-
-    - see 4-bit initializations procedure fig.24 on p.46 of HD44780
-      datasheet and p.17 of  WH1602B/WH1604B datasheet for details
+    - see "noBacklight()" for details
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::_initialization()
+void LiquidCrystal_I2C_Base::backlight()
 {
-  uint8_t displayFunction = 0; //don't change!!! default bits value DB7, DB6, DB5, DB4=(DL), DB3=(N), DB2=(F), DB1, DB0
+  _setBacklight(LCD_BACKLIGHT_ON);
 
-  /*
-     HD44780 & clones needs ~40ms after supply voltage rises above 2.7v
-     some Arduino boards can start & execute code at 2.4v, we'll wait 500ms
-  */
-  delay(500);
+  _writePCF8574(PCF8574_PORTS_LOW);
+}
 
-  /*
-     FIRST ATTEMPT: set 8-bit mode
-     - wait > 4.1msec, some LCD even slower than 4.5msec
-     - for Hitachi & Winstar displays
-  */
-  _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_8BIT_MODE), LCD_CMD_LENGTH_4BIT);
-  delay(5);
 
-  /*
-     SECOND ATTEMPT: set 8-bit mode
-     - wait > 100usec
-     - for Hitachi, not needed for Winstar displays
-  */
-  _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_8BIT_MODE), LCD_CMD_LENGTH_4BIT);
-  delayMicroseconds(200);
-	
-  /*
-     THIRD ATTEMPT: set 8 bit mode
-     - for Hitachi, not needed for Winstar displays
-  */
-  _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_8BIT_MODE), LCD_CMD_LENGTH_4BIT);
-  delayMicroseconds(100);
-	
-  /*
-     FINAL ATTEMPT: set 4-bit interface
-     - the Busy Flag (BF) can be checked after this instruction
-  */
-  _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_4BIT_MODE), LCD_CMD_LENGTH_4BIT);
+/**************************************************************************/
+/*
+    _setBacklight()
 
-  /* sets quantity of lines */
-  if (_lcdRows > 1) {displayFunction |= LCD_2_LINE;}     //line bit located at BD3 & zero/1 line by default
+    Sets backlight value mixed with every PCF8574 write
 
-  /* sets font size, 5x8 by default */
-  if (_lcdFontSize == LCD_5x10DOTS)
+    NOTE:
+    - value LCD_BACKLIGHT_ON or LCD_BACKLIGHT_OFF, inverted for NEGATIVE
+      polarity & shifted to backlight PCF8574 port
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_setBacklight(uint8_t value)
+{
+  switch (_backlightPolarity)
   {
-    displayFunction |= LCD_5x10DOTS;                     //font bit located at BD2
+    case POSITIVE:
+      _backlightValue = value;
+      break;
 
-    if (_lcdRows != 1) {displayFunction &= ~LCD_2_LINE;} //safety check, 2-rows displays can't display 10-pixels hight font
+    case NEGATIVE:
+      _backlightValue = ~value;
+      break;
   }
 
-  /* initializes LCD functions: quantity of lines, font size, etc., this settings can't be changed after this point */
-  _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_4BIT_MODE | displayFunction), LCD_CMD_LENGTH_8BIT);
-	
-  /* initializes LCD controls: turn display off, underline cursor off & blinking cursor off */
-  _displayControl = LCD_UNDERLINE_CURSOR_OFF | LCD_BLINK_CURSOR_OFF;
-  noDisplay();
-
-  /* clear display */
-  clear();
-
-  /* initializes LCD basics: sets text direction "left to right" & cursor movement to the right */
-  _displayMode = LCD_ENTRY_LEFT | LCD_ENTRY_SHIFT_OFF;
-  _send(LCD_INSTRUCTION_WRITE, (LCD_ENTRY_MODE_SET | _displayMode), LCD_CMD_LENGTH_8BIT);
-
-  display();
+  _backlightValue <<= _backlightPort();
 }
 
 
-/************************* !!! bonus function !!! *************************/
+/**************************************************************************/
 /*
-    printHorizontalGraph()
+    isCharacterVisible()
 
-    Prints linear scale horizontal graph
+    Returns true if character is on the screen or waits for "flush()"
+
+    NOTE:
+    - custom characters 0..7 & 8..15 share the same CGRAM, both
+      addresses are checked
+
+    - always true without framebuffer, LCD contents is unknown & any
+      character may be on the screen
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::printHorizontalGraph(char name, uint8_t row, uint16_t setValue, uint16_t maxValue)
+bool LiquidCrystal_I2C_Base::isCharacterVisible(uint8_t character)
 {
- /* get quantity of "solid squares" */
-  setValue = constrain(setValue, 0, maxValue);           //safety check, to prevent ESP8266 crash
-
-  setValue = map(setValue, 0, maxValue, 0, _lcdColumns); //quantity of "solid squares"
-
-  /* print bar name */
-  setCursor(0, row);
+  if (_framebuffer == NULL) {return true;}
 
-  _send(LCD_DATA_WRITE, name, LCD_CMD_LENGTH_8BIT);      //print graph name at column 0
+  if (character < 16) {character &= 0x07;}
 
-  /* print horizontal bar */
-  for (uint8_t i = 1; i < setValue; i++)
+  for (uint16_t i = 0; i < LCD_FRAMEBUFFER_SIZE(_lcdColumns, _lcdRows); i++)
   {
-    setCursor(i, row);
-
-    _send(LCD_DATA_WRITE, 0xFF, LCD_CMD_LENGTH_8BIT);    //0xFF=built in "solid square" symbol, see p.17 & p.30 of HD44780 datasheet
+    if (_framebuffer[i] == character)                                    {return true;}
+    if ((character < 8) && (_framebuffer[i] == (uint8_t)(character + 8))) {return true;}
   }
 
-  /* fill the rest with spaces */
-  while (setValue++ < _lcdColumns)
-  {
-    _send(LCD_DATA_WRITE, 0x20, LCD_CMD_LENGTH_8BIT);    //0x20=built in "space" symbol, see p.17 & p.30 of HD44780 datasheet
-  }
+  return false;
 }
 
 
-/************************* !!! bonus function !!! *************************/
+/**************************************************************************/
 /*
-    displayOff()
+    enableQueue()
 
-    Turns off backlight via PCF8574 & clears text from the screen
+    Redirects all commands & characters to the ring buffer in MCU memory,
+    every function returns without waiting for I2C bus & LCD
 
     NOTE:
-    - text remains in DDRAM
+    - call after "begin()", buffer size is "LCD_QUEUE_SIZE(commands)"
+      bytes, every command or character takes one place:
+      - uint8_t lcdQueue[LCD_QUEUE_SIZE(64)];
+        lcd.enableQueue(lcdQueue, sizeof(lcdQueue));
+
+    - call "tick()" from "loop()" or timer task to send queued commands
+
+    - if buffer is full, function waits & calls "tick()" until one
+      place is free
+
+    - "setPacing()" can't be changed while queue is enabled, queued
+      commands always use fixed command durations
+
+    - "noBacklight()" & "backlight()" are not queued
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::displayOff()
+bool LiquidCrystal_I2C_Base::enableQueue(uint8_t *buffer, uint16_t size)
 {
-  noBacklight();
-  
-  noDisplay();
+  if ((buffer == NULL) || (size < LCD_QUEUE_SIZE(1))) {return false;} //safety check, make sure buffer is big enough
+
+  _queueSize  = size / LCD_QUEUE_SIZE(1);
+  _queueHead  = 0;
+  _queueCount = 0;
+  _queueTime  = micros();
+  _queueDelay = 0;
+  _queue      = buffer;
+
+  return true;
 }
 
 
-/************************* !!! bonus function !!! *************************/
+/**************************************************************************/
 /*
-    displayOn()
+    disableQueue()
 
-    Turns on backlight via PCF8574 & shows text from DDRAM
+    Sends all queued commands & returns to blocking mode
+
+    NOTE:
+    - blocks until queue is empty
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::displayOn()
+void LiquidCrystal_I2C_Base::disableQueue()
 {
-  display();
+  if (_queue == NULL) {return;}
 
-  backlight();
+  while (tick(0xFF) == true) {}
+
+  while ((micros() - _queueTime) < _queueDelay) {} //last command duration
+
+  _queue = NULL;
 }
 
 
-/************************* !!! bonus function !!! *************************/
+/**************************************************************************/
 /*
-    setBrightness()
+    tick()
+
+    Sends queued commands to LCD, if LCD is ready
 
     NOTE:
-    - remove "LED" jumper from PCF8574 expansion board & connect top pin
-      to Arduino PWM pin in series with 470 Ohm resistor
+    - never waits for LCD, returns immediately if last command is
+      still executing
 
-    - ESP8266 doesn't have hardware PWM, with PWM output frequecy at
-      40KHz CPU is very loaded!!!
+    - sends up to "maxCommands" commands or characters in one I2C
+      transaction, "clear()" & "home()" always end transaction
 
-    - ESP32 & ESP32-xx has from 6..16 hardware PWM channels
+    - one command at 100kHz takes ~0.5msec of I2C bus time, 0.13msec
+      at 400kHz, see "_sendData()" for packing details
 
-    - recomended voltage on "LED" top pin 0.50v..4.5v 
+    - returns true if queue is not empty
 */
 /**************************************************************************/
-#if defined (ARDUINO_ARCH_ESP32)
-void LiquidCrystal_I2C::setBrightness(uint8_t pin, uint8_t value, uint8_t channel)
-#else
-void LiquidCrystal_I2C::setBrightness(uint8_t pin, uint8_t value)
-#endif
+bool LiquidCrystal_I2C_Base::tick(uint8_t maxCommands)
 {
-  #if !defined (ARDUINO_ARCH_ESP32)
-  pinMode(pin, OUTPUT);
-  #endif
+  uint8_t  buffer[LCD_I2C_BUFFER_LENGTH];
+  uint8_t  length = 0;
+  uint8_t *entry;
+  uint8_t  mode;
 
-  #if defined (ARDUINO_ARCH_ESP8266)
-//analogWriteResolution(8);                                  //set PWM resolution 4-bit(15)..16-bit(65535), default 8-bit(256)
-//analogWriteFreq(1000);                                     //set ESP8266 PWM frequecy 100Hz..40KHz, default 1000Hz
+  if (_queue == NULL)                                 {return false;}
+  if ((micros() - _queueTime) < _queueDelay)          {return (_queueCount != 0);} //LCD is busy
+
+  while ((_queueCount != 0) && (maxCommands-- > 0))
+  {
+    if ((length + 4 + _dataPadding) > LCD_I2C_BUFFER_LENGTH) {break;}              //4-bytes command doesn't fit into "wire.h" txBuffer
+
+    entry = &_queue[((_queueHead + _queueSize - _queueCount) % _queueSize) * 2];   //oldest command
+    mode  = entry[0] & ~LCD_QUEUE_4BIT;
+
+    for (uint8_t i = 0; (i < _dataPadding) && (length > 0); i++)                  //repeat E=0 byte of previous command, see "_sendData()"
+    {
+      buffer[length] = buffer[length - 1];
+      length++;
+    }
+
+    length += _encode(mode, entry[1], ((entry[0] & LCD_QUEUE_4BIT) != 0) ? LCD_CMD_LENGTH_4BIT : LCD_CMD_LENGTH_8BIT, &buffer[length]);
+
+    _queueCount--;
+
+    _queueDelay = _commandDelay;
+
+    if ((mode == LCD_INSTRUCTION_WRITE) && (entry[1] < LCD_ENTRY_MODE_SET))         //"clear()" or "home()"
+    {
+      _queueDelay = _homeClearDelay;
+
+      break;                                                                       //the next command must wait
+    }
+  }
+
+  if (length != 0)
+  {
+    _writePCF8574(buffer, length);
+
+    _queueTime = micros();
+  }
+
+  return (_queueCount != 0);
+}
+
+
+/**************************************************************************/
+/*
+    queueLength()
+
+    Returns quantity of queued commands & characters
+*/
+/**************************************************************************/
+uint16_t LiquidCrystal_I2C_Base::queueLength()
+{
+  return _queueCount;
+}
+
+
+/**************************************************************************/
+/*
+    setPacing()
+
+    Sets the way to wait for command execution
+
+    NOTE:
+    - LCD_PACING_DELAY, waits worst case command duration 43usec &
+      2msec for "clear()" & "home()"
+
+    - LCD_PACING_BUSY_FLAG, polls Busy Flag (BF) & sends the next command
+      as soon as LCD is ready:
+      - no polling if the next I2C transaction takes longer than
+        command duration, ~70usec at 400kHz
+      - no polling if the rest of command duration is shorter than
+        two BF reads, fixed delay instead, so at 100kHz only
+        LCD_PACING_DELAY is used
+      - falls back to LCD_PACING_DELAY if BF stuck longer than
+        "LCD_BUSY_FLAG_TIMEOUT"
+
+    - call after "begin()", LCD RW pin must be connected to PCF8574,
+      BF & address counter readback tested before mode is changed
+
+    - test moves cursor, it is restored only for DDRAM address
+
+    - returns false if BF can't be read, pacing stays unchanged
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::setPacing(lcdPacing mode)
+{
+  if (mode == LCD_PACING_DELAY) {_pacing = mode; return true;}
+
+  if (_queue != NULL)           {return false;} //BF test needs blocking I/O, see "enableQueue()"
+
+  _pacing = LCD_PACING_DELAY;                  //test with fixed delays
+
+  if (_checkAddressCounter() == false)
+  {
+    _send(LCD_INSTRUCTION_WRITE, LCD_DDRAM_ADDR_SET, LCD_CMD_LENGTH_8BIT); //BF & address counter can't be read, move cursor to home position
+
+    return false;
+  }
+
+  _pacing = mode;
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    getPacing()
+
+    Returns current pacing mode
+
+    NOTE:
+    - LCD_PACING_BUSY_FLAG changes to LCD_PACING_DELAY on BF timeout,
+      see "setPacing()"
+*/
+/**************************************************************************/
+lcdPacing LiquidCrystal_I2C_Base::getPacing()
+{
+  return _pacing;
+}
+
+
+/**************************************************************************/
+/*
+    getStats()
+
+    Returns I2C bus statistics since "begin()" or "resetStats()"
+
+    NOTE:
+    - bus load, in %:
+      - "(bytes + transactions) * 9 * 1000000 / speed / time * 100",
+        "9" is 8-bit data + ACK, every transaction adds address byte
+
+    - errors[1] & errors[2] are NACK on address & NACK on data, on
+      long or noisy wires they grow before LCD shows garbage
+*/
+/**************************************************************************/
+lcdStats LiquidCrystal_I2C_Base::getStats()
+{
+  return _stats;
+}
+
+
+/**************************************************************************/
+/*
+    resetStats()
+
+    Sets all I2C bus statistics to zero
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::resetStats()
+{
+  memset(&_stats, 0, sizeof(_stats));
+}
+
+
+/**************************************************************************/
+/*
+    setBeginOptions()
+
+    Sets options applied by the next "begin()"
+
+    NOTE:
+    - options, may be combined with "|":
+      - LCD_BEGIN_CALIBRATE, measures command duration of this LCD, see
+        "calibrateTiming()"
+      - LCD_BEGIN_WARM, if LCD is already initialized, after watchdog or
+        software reset, skips 500msec power-on delay & soft reset, only
+        LCD settings are sent again, see "isWarmRestart()"
+      - LCD_BEGIN_KEEP_TEXT, keeps screen contents after warm restart,
+        otherwise screen is cleared
+      - LCD_BEGIN_TUNE_SPEED, speed passed to "begin()" is the lowest,
+        faster speeds are tested, see "tuneSpeed()"
+
+    - call before "begin()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::setBeginOptions(uint8_t options)
+{
+  _beginOptions = options;
+}
+
+
+/**************************************************************************/
+/*
+    calibrateTiming()
+
+    Measures command duration of this LCD & uses it instead of datasheet
+    worst case
+
+    NOTE:
+    - "clear()" & "home()" duration measured with Busy Flag (BF), the
+      shortest delay after command with BF=0 is searched, upper bound
+      of BF low time is taken, measurement takes ~0.2sec
+
+    - command duration is shorter than one BF read, so characters are
+      written with less E=0 padding bytes & read back, the shortest
+      padding without errors gives command duration, only I2C speed
+      > 400kHz has padding, see "_sendData()"
+
+    - the worst sample + "LCD_CALIBRATION_MARGIN" is used & never less
+      than measurement resolution
+
+    - DDRAM contents is lost, display is cleared after calibration
+
+    - returns false & keeps datasheet timing if BF or DDRAM can't be
+      read, in queue or framebuffer mode
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::calibrateTiming(uint8_t samples)
+{
+  uint8_t   data[4];
+  uint32_t  startTime;
+  uint32_t  sampleTime;
+  uint32_t  duration;
+  uint32_t  homeClearDelay = 0;
+  uint16_t  commandDelay   = LCD_COMMAND_DELAY;
+  uint8_t   padding;
+  uint8_t   datasheetPadding;
+  lcdPacing pacing         = _pacing;
+
+  if ((_queue != NULL) || (_framebuffer != NULL) || (samples == 0)) {return false;} //calibration needs blocking I/O
+
+  _setTiming(LCD_COMMAND_DELAY, LCD_HOME_CLEAR_DELAY * 1000);                         //measure with datasheet timing
+
+  _pacing = LCD_PACING_DELAY;
+
+  /* time from the beginning of BF read to BF sampling, E=1 write & PCF8574 read, see "_read()" */
+  startTime  = micros();
+
+  _writePCF8574(PCF8574_PORTS_LOW);
+  _readPCF8574();
+
+  sampleTime = micros() - startTime;
+
+  /* "clear()" & "home()" duration, the shortest delay before BF read with BF=0 */
+  for (uint8_t i = 0; i < samples; i++)
+  {
+    uint16_t low  = 0;
+    uint16_t high = LCD_BUSY_FLAG_TIMEOUT;
+
+    while ((high - low) > LCD_CALIBRATION_STEP)
+    {
+      uint16_t delayTime = (low + high) / 2;
+
+      _writePCF8574(data, _encode(LCD_INSTRUCTION_WRITE, ((i & 0x01) == 0) ? LCD_CLEAR_DISPLAY : LCD_RETURN_HOME, LCD_CMD_LENGTH_8BIT, data));
+
+      delayMicroseconds(delayTime);
+
+      if (_readBusyFlag() == true) {low  = delayTime;}
+      else                         {high = delayTime;}
+
+      startTime = micros();
+
+      while (_readBusyFlag() == true)                                                 //wait for the end of command
+      {
+        if ((micros() - startTime) > LCD_BUSY_FLAG_TIMEOUT) {_pacing = pacing; clear(); return false;} //BF stuck, RW not connected
+      }
+    }
+
+    if (high >= LCD_BUSY_FLAG_TIMEOUT) {_pacing = pacing; clear(); return false;}     //BF never low
+
+    duration = high + sampleTime;                                                     //BF was low before this time
+
+    if (duration > homeClearDelay) {homeClearDelay = duration;}
+  }
+
+  /* command duration, characters with shorter padding are read back */
+  padding = datasheetPadding = _dataPadding;
+
+  while (padding > 0)
+  {
+    _dataPadding = padding - 1;                                                       //try shorter padding
+
+    if (_checkTiming(samples, 0x00) == false) {break;}
+
+    padding--;
+  }
+
+  if (padding < datasheetPadding)                                                     //at least one padding byte saved
+  {
+    commandDelay = ((uint32_t)(padding + 2) * LCD_I2C_BIT_PER_BYTE * 1000000UL) / _i2cSpeed; //E falling edges distance of the shortest padding, in usec
+  }
+
+  _setTiming(commandDelay + (commandDelay * LCD_CALIBRATION_MARGIN / 100), homeClearDelay + (homeClearDelay * LCD_CALIBRATION_MARGIN / 100));
+
+  _pacing = pacing;
+
+  clear();
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    isWarmRestart()
+
+    Returns true if the last "begin()" found LCD already initialized &
+    skipped power-on delay & soft reset
+
+    NOTE:
+    - see "setBeginOptions()"
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::isWarmRestart()
+{
+  return _warmRestart;
+}
+
+
+/**************************************************************************/
+/*
+    tuneSpeed()
+
+    Selects the fastest I2C speed of 100kHz, 400kHz & 1MHz which writes &
+    reads back DDRAM without errors, faster than current speed only
+
+    NOTE:
+    - every speed is tested "LCD_SPEED_TUNE_MARGIN" faster than selected,
+      e.g. 1MHz is selected if 1.25MHz passes, so long wire or weak pull-up
+      resistors which barely work are rejected
+
+    - test passes if all "rounds" of 8 characters are read back & no I2C
+      errors counted, see "getStats()", faster speeds are not tested after
+      the 1-st failure
+
+    - 8 DDRAM addresses from "LCD_SPEED_TUNE_ADDRESS" are used, off-screen
+      for 16x2 & 8x2, contents & cursor position are restored
+
+    - if LCD lost 4-bit sync at failed speed, it is initialized again & screen
+      is cleared
+
+    - PCF8574 is specified for 100kHz only, most modules works at 400kHz, some
+      at 1MHz
+
+    - speed is not tested if MCU I2C can't run it with margin, e.g. 1MHz on
+      16MHz AVR, the fastest TWI clock is 1MHz
+
+    - speed is changed by "LiquidCrystal_I2C_Bus::begin()", bus with fixed
+      speed, like "LiquidCrystal_I2C_LinuxI2C", gains nothing
+
+    - call after "begin()" or use LCD_BEGIN_TUNE_SPEED, LCD RW pin must be
+      connected to PCF8574
+
+    - returns false & keeps current speed if DDRAM can't be read, in queue or
+      framebuffer mode
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::tuneSpeed(uint8_t rounds)
+{
+  const uint32_t  speeds[3] = {100000, 400000, 1000000};
+        uint8_t   saved[8];
+        uint8_t   ddramAddress;
+        uint32_t  speed       = _i2cSpeed;                                            //the fastest verified speed
+        bool      synced      = true;
+        lcdPacing pacing      = _pacing;
+
+  if ((_queue != NULL) || (_framebuffer != NULL) || (rounds == 0)) {return false;} //test needs blocking I/O
+
+  _restoreAddress(false);                                                           //after "createChar()" or "writeCGRAM()"
+
+  _pacing = LCD_PACING_DELAY;
+
+  if (_checkAddressCounter() == false)
+  {
+    _send(LCD_INSTRUCTION_WRITE, LCD_DDRAM_ADDR_SET, LCD_CMD_LENGTH_8BIT);           //DDRAM can't be read, move cursor to home position
+
+    _pacing = pacing;
+
+    return false;
+  }
+
+  /* save test area & cursor position at current speed */
+  ddramAddress = _read(LCD_BUSY_FLAG_READ) & 0x7F;
+
+  _setAddress(LCD_SPEED_TUNE_ADDRESS);
+
+  for (uint8_t i = 0; i < sizeof(saved); i++) {saved[i] = _read(LCD_DATA_READ);}
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (speeds[i] <= speed) {continue;}
+
+    uint32_t testSpeed = speeds[i] + ((speeds[i] / 100) * LCD_SPEED_TUNE_MARGIN);
+
+    #if defined (ARDUINO_ARCH_AVR) && defined (F_CPU)
+    if (testSpeed > (F_CPU / 16)) {testSpeed = F_CPU / 16;}                         //TWBR=0, the fastest AVR TWI clock, faster value overflows TWBR
+    #endif
+
+    if (testSpeed < speeds[i] + ((speeds[i] / 100) * LCD_SPEED_TUNE_MARGIN)) {break;} //MCU I2C can't run with margin, e.g. 1MHz on 16MHz AVR
+
+    lcdStats stats  = _stats;
+    bool     passed = (_setSpeed(testSpeed) == true) && (_checkTiming(rounds, LCD_SPEED_TUNE_ADDRESS) == true);
+
+    if ((memcmp(stats.errors, _stats.errors, sizeof(stats.errors)) != 0) || (stats.readErrors != _stats.readErrors)) {passed = false;} //NACK, lost byte
+
+    if (passed == false)
+    {
+      _setSpeed(speed);
+
+      synced = _checkAddressCounter();
+
+      if (synced == false) {_initialization();}                                      //nibbles out of sync
+
+      break;
+    }
+
+    speed = speeds[i];
+  }
+
+  _setSpeed(speed);
+
+  /* restore test area & cursor position at selected speed */
+  if (synced == true)
+  {
+    _setAddress(LCD_SPEED_TUNE_ADDRESS);
+
+    _sendData(saved, sizeof(saved), false);
+
+    _setAddress(ddramAddress);
+  }
+
+  _pacing = pacing;
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    getSpeed()
+
+    Returns current I2C speed, in Hz
+
+    NOTE:
+    - speed passed to "begin()" or selected by "tuneSpeed()"
+*/
+/**************************************************************************/
+uint32_t LiquidCrystal_I2C_Base::getSpeed()
+{
+  return _i2cSpeed;
+}
+
+
+/**************************************************************************/
+/*
+    getColumns()
+
+    Returns quantity of columns passed to "begin()"
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Base::getColumns()
+{
+  return _lcdColumns;
+}
+
+
+/**************************************************************************/
+/*
+    getRows()
+
+    Returns quantity of rows passed to "begin()"
+
+    NOTE:
+    - 1 row LCD runs in 1-line mode, DDRAM is one 80-characters line
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Base::getRows()
+{
+  return _lcdRows;
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Sends character to LCD
+
+    NOTE:
+    - replacement for Arduino "write()" in class "Print"
+*/
+/**************************************************************************/
+size_t LiquidCrystal_I2C_Base::write(uint8_t character)
+{
+  if (_framebuffer != NULL) {_bufferWrite(character); return 1;}
+
+  _restoreAddress(false);                                               //after "createChar()" or "writeCGRAM()"
+
+  _send(LCD_DATA_WRITE, character, LCD_CMD_LENGTH_8BIT);
+
+  return 1;
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Sends string to LCD
+
+    NOTE:
+    - replacement for Arduino "write(const uint8_t *buffer, size_t size)"
+      in class "Print", called by "print()" for strings & numbers
+
+    - characters are packed into as few I2C transactions as "wire.h"
+      txBuffer allows, see "_sendData()" for details
+*/
+/**************************************************************************/
+size_t LiquidCrystal_I2C_Base::write(const uint8_t *buffer, size_t size)
+{
+  if (_framebuffer != NULL)
+  {
+    for (size_t i = 0; i < size; i++) {_bufferWrite(buffer[i]);}
+
+    return size;
+  }
+
+  _restoreAddress(false);                                               //after "createChar()" or "writeCGRAM()"
+
+  _sendData(buffer, size, false);
+
+  return size;
+}
+
+
+/**************************************************************************/
+/*
+    enableFramebuffer()
+
+    Redirects "write()", "print()", "setCursor()", "clear()" & "home()"
+    to the shadow DDRAM in MCU memory
+
+    NOTE:
+    - call after "begin()", buffer size must be at least
+      "LCD_FRAMEBUFFER_SIZE(columns, rows)" bytes, 20x4 LCD needs 160-bytes:
+      - uint8_t lcdBuffer[LCD_FRAMEBUFFER_SIZE(20, 4)];
+        lcd.enableFramebuffer(lcdBuffer, sizeof(lcdBuffer));
+
+    - buffer keeps new & displayed characters, only differences are
+      sent by "flush()", so "clear()" & redraw of the same text costs
+      nothing
+
+    - nothing is sent to LCD until "flush()" is called, the first
+      "flush()" redraws the whole screen
+
+    - text wraps to the next row at the end of the row, instead of
+      following DDRAM addresses, see "setCursor()"
+
+    - "autoscroll()" & "scrollDisplayLeft()"/"scrollDisplayRight()"
+      are not tracked by framebuffer
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::enableFramebuffer(uint8_t *buffer, uint16_t size)
+{
+  if ((buffer == NULL) || (size < LCD_FRAMEBUFFER_SIZE(_lcdColumns, _lcdRows))) {return false;} //safety check, make sure buffer is big enough
+
+  memset(buffer, LCD_SPACE_SYMBOL, LCD_FRAMEBUFFER_SIZE(_lcdColumns, _lcdRows));              //empty screen
+
+  _framebuffer  = buffer;
+  _flushAll     = true;                                                                       //LCD contents unknown, see NOTE
+  _cursorColumn = 0;
+  _cursorRow    = 0;
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    disableFramebuffer()
+
+    Sends framebuffer changes to LCD & returns to direct mode, where
+    every "write()" goes to LCD
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::disableFramebuffer()
+{
+  if (_framebuffer == NULL) {return;}
+
+  flush();
+
+  _framebuffer = NULL;
+
+  _setAddress(_ddramAddress(_cursorColumn, _cursorRow)); //sync LCD cursor with framebuffer cursor
+}
+
+
+/**************************************************************************/
+/*
+    flush()
+
+    Sends changed framebuffer cells to LCD
+
+    NOTE:
+    - changed cells grouped into runs, one DDRAM address command
+      per run & all run characters packed in few I2C transactions
+
+    - runs separated by "LCD_FLUSH_MERGE_GAP" or less unchanged cells
+      merged together, one character costs less than address command
+
+    - runs are sent in "left to right" mode without autoscroll, entry
+      mode set by "rightToLeft()" & "autoscroll()" restored after update
+
+    - LCD cursor moved to framebuffer cursor position after update, if
+      underline or blinking cursor is ON
+
+    - replacement for Arduino "flush()" in class "Print"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::flush()
+{
+  if (_framebuffer == NULL) {return;}
+
+  uint8_t *newCells       = _framebuffer;
+  uint8_t *displayedCells = &_framebuffer[(uint16_t)_lcdColumns * _lcdRows];
+  uint8_t  displayMode    = _displayMode;
+  uint16_t cell;
+  uint8_t  runStart;
+  uint8_t  runEnd;
+  uint8_t  gap;
+
+  for (uint8_t row = 0; row < _lcdRows; row++)
+  {
+    uint8_t column = 0;
+
+    while (column < _lcdColumns)
+    {
+      cell = ((uint16_t)row * _lcdColumns) + column;
+
+      if ((newCells[cell] == displayedCells[cell]) && (_flushAll == false)) {column++; continue;} //skip unchanged cell
+
+      /* find the end of run, merge short gaps of unchanged cells */
+      runStart = column;
+      runEnd   = column;
+      gap      = 0;
+
+      while ((++column < _lcdColumns) && (gap <= LCD_FLUSH_MERGE_GAP))
+      {
+        cell++;
+
+        if ((newCells[cell] != displayedCells[cell]) || (_flushAll == true)) {runEnd = column; gap = 0;}
+        else                                                                 {gap++;}
+      }
+
+      column = runEnd + 1;
+
+      /* send run */
+      cell = ((uint16_t)row * _lcdColumns) + runStart;
+
+      if (_displayMode != (LCD_ENTRY_LEFT | LCD_ENTRY_SHIFT_OFF))                          //runs assume address counter increment
+      {
+        _displayMode = LCD_ENTRY_LEFT | LCD_ENTRY_SHIFT_OFF;
+
+        _send(LCD_INSTRUCTION_WRITE, (LCD_ENTRY_MODE_SET | _displayMode), LCD_CMD_LENGTH_8BIT);
+      }
+
+      _setAddress(_ddramAddress(runStart, row));                                         //skipped if the previous run ends here
+
+      _sendData(&newCells[cell], (runEnd - runStart + 1), false);
+
+      memcpy(&displayedCells[cell], &newCells[cell], (runEnd - runStart + 1));
+    }
+  }
+
+  _flushAll = false;
+
+  if (_displayMode != displayMode)                                                      //restore "rightToLeft()" & "autoscroll()"
+  {
+    _displayMode = displayMode;
+
+    _send(LCD_INSTRUCTION_WRITE, (LCD_ENTRY_MODE_SET | _displayMode), LCD_CMD_LENGTH_8BIT);
+  }
+
+  if ((_displayControl & (LCD_UNDERLINE_CURSOR_ON | LCD_BLINK_CURSOR_ON)) != 0)         //show cursor at framebuffer cursor position
+  {
+    _setAddress(_ddramAddress(_cursorColumn, _cursorRow));
+  }
+}
+
+
+/**************************************************************************/
+/*
+    _initialization()
+
+    Soft reset LCD & activate 4-bit interface
+
+    NOTE:
+    - for correct LCD operation it is necessary to do the internal circuit
+      reset & initialization procedure
+
+    - see 4-bit initializations procedure fig.24 on p.46 of HD44780
+      datasheet and p.17 of  WH1602B/WH1604B datasheet for details
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_initialization()
+{
+  uint8_t   displayFunction = 0;       //don't change!!! default bits value DB7, DB6, DB5, DB4=(DL), DB3=(N), DB2=(F), DB1, DB0
+  lcdPacing pacing          = _pacing; //Busy Flag (BF) can't be checked until 4-bit interface is set
+
+  _pacing = LCD_PACING_DELAY;
+
+  /*
+     WARM RESTART: LCD never lost power & is still in 4-bit mode
+     - wait for the end of "clear()" or "home()" sent before MCU reset
+     - address counter readback fails in 8-bit mode after power-on or
+       if MCU reset happened between two nibbles
+  */
+  _warmRestart = false;
+
+  if ((_beginOptions & LCD_BEGIN_WARM) != 0)
+  {
+    delay(LCD_HOME_CLEAR_DELAY);
+
+    _warmRestart = _checkAddressCounter();
+  }
+
+  if (_warmRestart == false)
+  {
+    /*
+       HD44780 & clones needs ~40ms after supply voltage rises above 2.7v
+       some Arduino boards can start & execute code at 2.4v, we'll wait 500ms
+    */
+    delay(500);
+
+    /*
+       FIRST ATTEMPT: set 8-bit mode
+       - wait > 4.1msec, some LCD even slower than 4.5msec
+       - for Hitachi & Winstar displays
+    */
+    _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_8BIT_MODE), LCD_CMD_LENGTH_4BIT);
+    delay(5);
+
+    /*
+       SECOND ATTEMPT: set 8-bit mode
+       - wait > 100usec
+       - for Hitachi, not needed for Winstar displays
+    */
+    _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_8BIT_MODE), LCD_CMD_LENGTH_4BIT);
+    delayMicroseconds(200);
+
+    /*
+       THIRD ATTEMPT: set 8 bit mode
+       - for Hitachi, not needed for Winstar displays
+    */
+    _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_8BIT_MODE), LCD_CMD_LENGTH_4BIT);
+    delayMicroseconds(100);
+
+    /*
+       FINAL ATTEMPT: set 4-bit interface
+       - the Busy Flag (BF) can be checked after this instruction
+    */
+    _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_4BIT_MODE), LCD_CMD_LENGTH_4BIT);
+  }
+
+  /* sets quantity of lines */
+  if (_lcdRows > 1) {displayFunction |= LCD_2_LINE;}     //line bit located at BD3 & zero/1 line by default
+
+  /* sets font size, 5x8 by default */
+  if (_lcdFontSize == LCD_5x10DOTS)
+  {
+    displayFunction |= LCD_5x10DOTS;                     //font bit located at BD2
+
+    if (_lcdRows != 1) {displayFunction &= ~LCD_2_LINE;} //safety check, 2-rows displays can't display 10-pixels hight font
+  }
+
+  /* initializes LCD functions: quantity of lines, font size, etc., this settings can't be changed after this point */
+  _send(LCD_INSTRUCTION_WRITE, (LCD_FUNCTION_SET | LCD_4BIT_MODE | displayFunction), LCD_CMD_LENGTH_8BIT);
+	
+  /* initializes LCD controls: turn display off, underline cursor off & blinking cursor off */
+  _displayControl = LCD_UNDERLINE_CURSOR_OFF | LCD_BLINK_CURSOR_OFF;
+
+  /* initializes LCD basics: sets text direction "left to right" & cursor movement to the right, before "clear()" tracks address counter */
+  _displayMode = LCD_ENTRY_LEFT | LCD_ENTRY_SHIFT_OFF;
+
+  if ((_warmRestart == false) || ((_beginOptions & LCD_BEGIN_KEEP_TEXT) == 0)) //screen contents is kept on, no blinking
+  {
+    noDisplay();
+
+    /* clear display */
+    clear();
+  }
+
+  _send(LCD_INSTRUCTION_WRITE, (LCD_ENTRY_MODE_SET | _displayMode), LCD_CMD_LENGTH_8BIT);
+
+  _setAddress(0x00);                                    //known address counter after kept screen contents, free after "clear()"
+
+  display();
+
+  _pacing = pacing;
+}
+
+
+/************************* !!! bonus function !!! *************************/
+/*
+    printHorizontalGraph()
+
+    Prints linear scale horizontal graph
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::printHorizontalGraph(char name, uint8_t row, uint16_t setValue, uint16_t maxValue)
+{
+  uint8_t bar[LCD_MAX_COLUMNS];
+  uint8_t columns = (_lcdColumns < LCD_MAX_COLUMNS) ? _lcdColumns : LCD_MAX_COLUMNS; //safety check, graph fits in DDRAM row
+
+ /* get quantity of "solid squares" */
+  setValue = constrain(setValue, 0, maxValue);           //safety check, to prevent ESP8266 crash
+
+  setValue = map(setValue, 0, maxValue, 0, _lcdColumns); //quantity of "solid squares"
+
+  /* make the whole row & print it in one go */
+  bar[0] = name;                                         //print graph name at column 0
+
+  for (uint8_t i = 1; i < columns; i++)
+  {
+    bar[i] = (i < setValue) ? 0xFF : LCD_SPACE_SYMBOL;   //0xFF=built in "solid square" & 0x20=built in "space" symbol, see p.17 & p.30 of HD44780 datasheet
+  }
+
+  setCursor(0, row);
+
+  write(bar, columns);
+}
+
+
+/************************* !!! bonus function !!! *************************/
+/*
+    displayOff()
+
+    Turns off backlight via PCF8574 & clears text from the screen
+
+    NOTE:
+    - text remains in DDRAM
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::displayOff()
+{
+  noBacklight();
+  
+  noDisplay();
+}
+
+
+/************************* !!! bonus function !!! *************************/
+/*
+    displayOn()
+
+    Turns on backlight via PCF8574 & shows text from DDRAM
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::displayOn()
+{
+  display();
+
+  backlight();
+}
+
+
+/************************* !!! bonus function !!! *************************/
+/*
+    setBrightness()
+
+    NOTE:
+    - remove "LED" jumper from PCF8574 expansion board & connect top pin
+      to Arduino PWM pin in series with 470 Ohm resistor
+
+    - ESP8266 doesn't have hardware PWM, with PWM output frequecy at
+      40KHz CPU is very loaded!!!
+
+    - ESP32 & ESP32-xx has from 6..16 hardware PWM channels
+
+    - recomended voltage on "LED" top pin 0.50v..4.5v 
+*/
+/**************************************************************************/
+#if defined (ARDUINO_ARCH_ESP32)
+void LiquidCrystal_I2C_Base::setBrightness(uint8_t pin, uint8_t value, uint8_t channel)
+#else
+void LiquidCrystal_I2C_Base::setBrightness(uint8_t pin, uint8_t value)
+#endif
+{
+  #if !defined (ARDUINO_ARCH_ESP32)
+  pinMode(pin, OUTPUT);
+  #endif
+
+  #if defined (ARDUINO_ARCH_ESP8266)
+//analogWriteResolution(8);                                  //set PWM resolution 4-bit(15)..16-bit(65535), default 8-bit(256)
+//analogWriteFreq(1000);                                     //set ESP8266 PWM frequecy 100Hz..40KHz, default 1000Hz
   #elif defined (ARDUINO_ARCH_ESP32)
     #if ESP_IDF_VERSION_MAJOR >= 3
   ledcAttach(pin, 1000, channel);                            //set PWM channel xx to 1KHz period, 8-bit(256) resolution
@@ -821,59 +1841,498 @@ void LiquidCrystal_I2C::setBrightness(uint8_t pin, uint8_t value)
 //analogWriteResolution(8);                                  //set PWM resolution 8-bit(256)..16-bit(65535), default 8-bit(256)
   #endif
 
-  if (_backlightPolarity == NEGATIVE) {value = 255 - value;} //256=8-bit PWM
+  if (_backlightPolarity == NEGATIVE) {value = 255 - value;} //256=8-bit PWM
+
+  #if defined (ARDUINO_ARCH_ESP32)
+  ledcWrite(channel, value);                                 //set duty cycle for PWM channel xx
+  #else
+  analogWrite(pin, value);                                   //set duty cycle for pin
+  #endif
+}
+
+
+/**************************************************************************/
+/*
+    _send()
+
+    The most advanced & fastest way to sent COMMAND or DATA/TEXT to LCD
+    
+    NOTE:
+    - all inputs formated as follow: 
+      - mode : RS,RW,E=1,DB7,DB6,DB5,DB4,BCK_LED=0
+      - value: DB7,DB6,DB5,DB4,DB3,DB2,DB1,DB0
+
+    - all nibbles sent in one I2C transaction, PCF8574 updates ports
+      after each byte ACK, so En pulse duration is one byte on the bus
+      ~90usec at 100kHz & ~9usec at 1MHz
+
+    - command duration for HD44780 & clones varies 37usec..43usec
+    - En pulse duration > 450nsec
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_send(uint8_t mode, uint8_t value, uint8_t cmdLength)
+{
+  uint8_t data[4]; //E=1 & E=0 bytes of 1-st & 2-nd nibble
+
+  if      (cmdLength == LCD_CMD_LENGTH_4BIT) {_addressCounter = LCD_ADDRESS_UNKNOWN;} //initialization
+  else if (mode == LCD_INSTRUCTION_WRITE)    {_trackCommand(value);}
+  else                                       {_trackData(1);}
+
+  if (_queue != NULL)                                         //sent later by "tick()"
+  {
+    _queuePush((cmdLength == LCD_CMD_LENGTH_4BIT) ? (mode | LCD_QUEUE_4BIT) : mode, value);
+
+    return;
+  }
+
+  _writePCF8574(data, _encode(mode, value, cmdLength, data)); //send & execute command
+
+  _wait(_commandDelay);                                       //command duration, see NOTE
+}
+
+
+/**************************************************************************/
+/*
+    _sendData()
+
+    Sends DATA/TEXT to LCD with minimum I2C transactions
+
+    NOTE:
+    - characters packed into one I2C transaction until "wire.h" txBuffer
+      is full, address byte & START/STOP conditions are sent once per
+      transaction instead of once per nibble
+
+    - LCD needs 37usec..43usec to execute each character, "_dataPadding"
+      E=0 bytes are inserted between characters to keep this time on
+      the bus, no padding needed at 100kHz..400kHz
+
+    - set "flash" to true to read data from MCU flash memory/PROGMEM
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_sendData(const uint8_t *data, size_t size, bool flash)
+{
+  uint8_t buffer[LCD_I2C_BUFFER_LENGTH];
+  uint8_t length = 0;
+  uint8_t value;
+
+  _trackData(size);
+
+  while (size-- > 0)
+  {
+    if (_queue != NULL)                                                          //sent later by "tick()"
+    {
+      #if defined (PROGMEM)
+      _queuePush(LCD_DATA_WRITE, (flash == true) ? pgm_read_byte(data) : *data);
+      #else
+      _queuePush(LCD_DATA_WRITE, *data);
+      #endif
+
+      data++;
+
+      continue;
+    }
+
+    if ((length + 4 + _dataPadding) > LCD_I2C_BUFFER_LENGTH)                    //4-bytes character doesn't fit into "wire.h" txBuffer
+    {
+      _writePCF8574(buffer, length);                                             //send & execute characters
+
+      _wait(_commandDelay);                                                      //last character duration
+
+      length = 0;
+    }
+
+    #if defined (PROGMEM)
+    value = (flash == true) ? pgm_read_byte(data) : *data;
+    #else
+    value = *data;
+    #endif
+
+    data++;
+
+    for (uint8_t i = 0; (i < _dataPadding) && (length > 0); i++)                //repeat E=0 byte of previous character, see NOTE
+    {
+      buffer[length] = buffer[length - 1];
+      length++;
+    }
+
+    length += _encode(LCD_DATA_WRITE, value, LCD_CMD_LENGTH_8BIT, &buffer[length]);
+  }
+
+  if (length == 0) {return;}
+
+  _writePCF8574(buffer, length);                                                 //send & execute the rest of characters
+
+  _wait(_commandDelay);                                                          //last character duration
+}
+
+
+/**************************************************************************/
+/*
+    _encode()
+
+    Converts COMMAND or DATA/TEXT to PCF8574 port values
+
+    NOTE:
+    - see "_send()" for inputs format
+
+    - writes 2 bytes for 4-bit & 4 bytes for 8-bit command:
+      RS,RW,E=1,DB7,DB6,DB5,DB4,BCK_LED=0
+      RS,RW,E=0,DB7,DB6,DB5,DB4,BCK_LED=0
+      RS,RW,E=1,DB3,DB2,DB1,DB0,BCK_LED=0
+      RS,RW,E=0,DB3,DB2,DB1,DB0,BCK_LED=0
+
+    - no bit by bit mapping, PCF8574 port values are taken from lookup
+      tables built once by constructor, see "_portMapping()"
+
+    - returns quantity of written bytes
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C::_encode(uint8_t mode, uint8_t value, uint8_t cmdLength, uint8_t *data)
+{
+  mode    = _modeToPCF8574[mode >> 5];                  //RS,RW,E=1 mapped to PCF8574 ports
+
+  /* 4-bit or 1-st part of 8-bit command */
+  data[0] = mode | _nibbleToPCF8574[value >> 4];        //RS,RW,E=1,DB7,DB6,DB5,DB4,BCK_LED=0, send command
+                                                        //En pulse duration > 450nsec
+  data[1] = data[0] & ~_enPCF8574;                      //RS,RW,E=0,DB7,DB6,DB5,DB4,BCK_LED=0, execute command
+
+  if (cmdLength == LCD_CMD_LENGTH_4BIT) {return 2;}
+
+  /* 2-nd part of 8-bit command */
+  data[2] = mode | _nibbleToPCF8574[value & 0x0F];      //RS,RW,E=1,DB3,DB2,DB1,DB0,BCK_LED=0, send command
+                                                        //En pulse duration > 450nsec
+  data[3] = data[2] & ~_enPCF8574;                      //RS,RW,E=0,DB3,DB2,DB1,DB0,BCK_LED=0, execute command
+
+  return 4;
+}
+
+
+/**************************************************************************/
+/*
+    _ddramAddress()
+
+    Converts column & row to DDRAM address
+
+    NOTE:
+    - 3-rd & 4-th rows are continuation of 1-st & 2-nd DDRAM lines
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Base::_ddramAddress(uint8_t column, uint8_t row)
+{
+  uint8_t rowAddressOffset[4] = {0x00, 0x40, (uint8_t)(_lcdColumns + 0x00), (uint8_t)(_lcdColumns + 0x40)};
+
+  return rowAddressOffset[row & 0x03] + column;
+}
+
+
+/**************************************************************************/
+/*
+    _setAddress()
+
+    Sets DDRAM address, if address counter doesn't point to it already
+
+    NOTE:
+    - address counter is tracked by "_trackCommand()" & "_trackData()",
+      so consecutive "setCursor()" & "print()" of adjacent fields cost
+      one DDRAM address command
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_setAddress(uint8_t ddramAddress)
+{
+  if (ddramAddress == _addressCounter) {return;}
+
+  _send(LCD_INSTRUCTION_WRITE, (LCD_DDRAM_ADDR_SET | ddramAddress), LCD_CMD_LENGTH_8BIT);
+}
+
+
+/**************************************************************************/
+/*
+    _restoreAddress()
+
+    Returns address counter from CGRAM to DDRAM address used before
+    "createChar()" or "writeCGRAM()"
 
-  #if defined (ARDUINO_ARCH_ESP32)
-  ledcWrite(channel, value);                                 //set duty cycle for PWM channel xx
-  #else
-  analogWrite(pin, value);                                   //set duty cycle for pin
-  #endif
+    NOTE:
+    - "cursorOnly" restores only if underline or blinking cursor is ON,
+      otherwise address is restored by the next "write()" & costs nothing
+      if "setCursor()" comes first
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_restoreAddress(bool cursorOnly)
+{
+  if ((_addressCounter != LCD_ADDRESS_UNKNOWN) || (_ddramReturn == LCD_ADDRESS_UNKNOWN))           {return;} //not in CGRAM or nothing to restore
+  if ((cursorOnly == true) && ((_displayControl & (LCD_UNDERLINE_CURSOR_ON | LCD_BLINK_CURSOR_ON)) == 0)) {return;} //cursor is hidden, restore later
+
+  _setAddress(_ddramReturn);
 }
 
 
 /**************************************************************************/
 /*
-    _send()
+    _trackCommand()
+
+    Updates tracked address counter after command
 
-    The most advanced & fastest way to sent COMMAND or DATA/TEXT to LCD
-    
     NOTE:
-    - all inputs formated as follow: 
-      - mode : RS,RW,E=1,DB7,DB6,DB5,DB4,BCK_LED=0
-      - value: DB7,DB6,DB5,DB4,DB3,DB2,DB1,DB0
+    - "clear()" also sets "left to right" mode, see p.24 of HD44780
+      datasheet, tracked entry mode follows it
+    - CGRAM address & cursor shift commands make address counter
+      unknown, "setCursor()" is always sent after them, DDRAM address
+      before CGRAM address command is kept for "_restoreAddress()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_trackCommand(uint8_t command)
+{
+  if (((command & LCD_CGRAM_ADDR_SET) != 0) && ((command & LCD_DDRAM_ADDR_SET) == 0))          //remember DDRAM address, see "_restoreAddress()"
+  {
+    if (_addressCounter != LCD_ADDRESS_UNKNOWN) {_ddramReturn = _addressCounter;}
 
-    - command duration for HD44780 & clones varies 37usec..43usec
-    - En pulse duration > 450nsec
+    _addressCounter = LCD_ADDRESS_UNKNOWN;
+
+    return;
+  }
+
+  if      ((command & LCD_DDRAM_ADDR_SET) != 0)       {_addressCounter = command & 0x7F;}
+  else if ((command & LCD_FUNCTION_SET) != 0)         {return;}
+  else if ((command & LCD_CURSOR_DISPLAY_SHIFT) != 0) {if ((command & LCD_DISPLAY_SHIFT) == 0) {_addressCounter = LCD_ADDRESS_UNKNOWN;}} //display shift keeps address counter
+  else if ((command & (LCD_DISPLAY_CONTROL | LCD_ENTRY_MODE_SET)) != 0) {return;}
+  else if ((command & LCD_RETURN_HOME) != 0)          {_addressCounter = 0x00;}
+  else if ((command & LCD_CLEAR_DISPLAY) != 0)        {_addressCounter = 0x00; _displayMode |= LCD_ENTRY_LEFT;}
+
+  _ddramReturn = LCD_ADDRESS_UNKNOWN;                                                            //new DDRAM address or unknown
+}
+
+
+/**************************************************************************/
+/*
+    _trackData()
+
+    Moves tracked address counter after DDRAM characters write or read
+
+    NOTE:
+    - 1-line DDRAM wraps 0x4F..0x00, 2-lines DDRAM jumps 0x27..0x40
+      & 0x67..0x00, see p.11 of HD44780 datasheet
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::_send(uint8_t mode, uint8_t value, uint8_t cmdLength)
+void LiquidCrystal_I2C_Base::_trackData(size_t size)
 {
-  uint8_t halfByte; //LSB or MSB part of value
+  if (_addressCounter == LCD_ADDRESS_UNKNOWN) {return;}
 
-  /* 4-bit or 1-st part of 8-bit command */
-  halfByte  = value >> 3;                      //0,0,0,DB7,DB6,DB5,DB4,DB3
-  halfByte &= 0x1E;                            //0,0,0,DB7,DB6,DB5,DB4,BCK_LED=0 (value LBS)
-  halfByte  = _portMapping(mode | halfByte);   //RS,RW,E=1,DB7,DB6,DB5,DB4,BCK_LED=0
+  bool twoLines = (_lcdRows > 1);
+
+  while (size-- > 0)
+  {
+    if ((_displayMode & LCD_ENTRY_LEFT) != 0)                                                   //"left to right"
+    {
+      if (twoLines == true)
+      {
+        if      (_addressCounter == 0x27) {_addressCounter = 0x40;}
+        else if (_addressCounter == 0x67) {_addressCounter = 0x00;}
+        else                              {_addressCounter++;}
+      }
+      else {_addressCounter = (_addressCounter == 0x4F) ? 0x00 : (_addressCounter + 1);}
+    }
+    else                                                                                        //"right to left"
+    {
+      if (twoLines == true)
+      {
+        if      (_addressCounter == 0x40) {_addressCounter = 0x27;}
+        else if (_addressCounter == 0x00) {_addressCounter = 0x67;}
+        else                              {_addressCounter--;}
+      }
+      else {_addressCounter = (_addressCounter == 0x00) ? 0x4F : (_addressCounter - 1);}
+    }
+  }
+}
 
-  _writePCF8574(halfByte);                     //send command
-                                               //En pulse duration > 450nsec
-  bitClear(halfByte, _lcdToPCF8574[5]);        //RS,RW,E=0,DB7,DB6,DB5,DB4,BCK_LED=0
-  _writePCF8574(halfByte);                     //execute command
 
-  /* 2-nd part of 8-bit command */
-  if (cmdLength == LCD_CMD_LENGTH_8BIT)
+/**************************************************************************/
+/*
+    _bufferWrite()
+
+    Writes character to framebuffer at framebuffer cursor position &
+    moves cursor
+
+    NOTE:
+    - cursor moves according to "leftToRight()" & "rightToLeft()" &
+      wraps to the next/previous row
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_bufferWrite(uint8_t character)
+{
+  _framebuffer[((uint16_t)_cursorRow * _lcdColumns) + _cursorColumn] = character;
+
+  if ((_displayMode & LCD_ENTRY_LEFT) != 0) //"left to right"
+  {
+    if (++_cursorColumn < _lcdColumns) {return;}
+
+    _cursorColumn = 0;
+
+    if (++_cursorRow >= _lcdRows) {_cursorRow = 0;}
+  }
+  else                                      //"right to left"
+  {
+    if (_cursorColumn-- > 0) {return;}
+
+    _cursorColumn = _lcdColumns - 1;
+
+    if (_cursorRow-- == 0) {_cursorRow = _lcdRows - 1;}
+  }
+}
+
+
+/**************************************************************************/
+/*
+    _queuePush()
+
+    Adds command or character to the queue
+
+    NOTE:
+    - waits & sends the oldest commands if queue is full, see
+      "enableQueue()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_queuePush(uint8_t mode, uint8_t value)
+{
+  uint8_t *entry;
+
+  while (_queueCount >= _queueSize) {tick();} //queue is full
+
+  entry = &_queue[_queueHead * 2];
+
+  entry[0] = mode;
+  entry[1] = value;
+
+  _queueHead = (_queueHead + 1) % _queueSize;
+  _queueCount++;
+}
+
+
+/**************************************************************************/
+/*
+    _setTiming()
+
+    Sets command durations & E=0 padding bytes between characters
+
+    NOTE:
+    - durations never exceed datasheet worst case, except "clear()" &
+      "home()" measured on slow LCD
+
+    - LCD needs command duration to execute previous character before
+      the next E falling edge, "_dataPadding" extra E=0 bytes keep this
+      time on the bus, see "_sendData()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_setTiming(uint16_t commandDelay, uint16_t homeClearDelay)
+{
+  _commandDelay   = (commandDelay < LCD_COMMAND_DELAY) ? commandDelay : LCD_COMMAND_DELAY;
+  _homeClearDelay = (homeClearDelay < LCD_BUSY_FLAG_TIMEOUT) ? homeClearDelay : LCD_BUSY_FLAG_TIMEOUT;
+
+  _dataPadding  = ((uint32_t)_commandDelay * (_i2cSpeed / 1000) + (LCD_I2C_BIT_PER_BYTE * 1000 - 1)) / (LCD_I2C_BIT_PER_BYTE * 1000); //bytes between E falling edges
+
+  if (_dataPadding > 2) {_dataPadding -= 2;}               //E=1 & E=0 bytes of the next character already on the bus
+  else                  {_dataPadding  = 0;}
+}
+
+
+/**************************************************************************/
+/*
+    _checkTiming()
+
+    Writes test characters with current padding & reads them back
+
+    NOTE:
+    - characters are written to 8 DDRAM addresses from "ddramAddress",
+      every sample with different characters
+
+    - returns false if any character is lost
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::_checkTiming(uint8_t samples, uint8_t ddramAddress)
+{
+  uint8_t pattern[8];
+
+  for (uint8_t i = 0; i < samples; i++)
+  {
+    for (uint8_t j = 0; j < sizeof(pattern); j++) {pattern[j] = 0x21 + (((i * 11) + (j * 7)) % 0x5D);} //printable ROM characters, both nibbles change
+
+    _send(LCD_INSTRUCTION_WRITE, (LCD_DDRAM_ADDR_SET | ddramAddress), LCD_CMD_LENGTH_8BIT);
+
+    _sendData(pattern, sizeof(pattern), false);
+
+    _send(LCD_INSTRUCTION_WRITE, (LCD_DDRAM_ADDR_SET | ddramAddress), LCD_CMD_LENGTH_8BIT);
+
+    for (uint8_t j = 0; j < sizeof(pattern); j++)
+    {
+      if (_read(LCD_DATA_READ) != pattern[j]) {return false;}
+    }
+  }
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    _checkAddressCounter()
+
+    Checks that LCD is in 4-bit mode & Busy Flag (BF) & address counter
+    can be read
+
+    NOTE:
+    - two DDRAM addresses are set & read back, both nibbles of each
+      address differ, so 8-bit mode or nibbles out of sync fail
+
+    - test addresses are valid in 1-line & 2-line modes, readback of
+      address outside of DDRAM is undefined on clones
+
+    - address counter is restored on success
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::_checkAddressCounter()
+{
+  const uint8_t testAddress[2] = {0x45, 0x1A}; //both nibbles differ from each other & between addresses, 2-line DDRAM 0x00..0x27 & 0x40..0x67
+        uint8_t ddramAddress;
+
+  ddramAddress = _read(LCD_BUSY_FLAG_READ) & 0x7F;
+
+  for (uint8_t i = 0; i < 2; i++)
   {
-    halfByte  = value << 1;                    //DB6,DB5,DB4,DB3,DB2,DB1,DB0,0
-    halfByte &= 0x1E;                          //0,0,0,DB3,DB2,DB1,DB0,BCK_LED=0 (value MSB)
-    halfByte  = _portMapping(mode | halfByte); //RS,RW,E=1,DB3,DB2,DB1,DB0,BCK_LED=0
+    _send(LCD_INSTRUCTION_WRITE, (LCD_DDRAM_ADDR_SET | testAddress[i]), LCD_CMD_LENGTH_8BIT);
 
-    _writePCF8574(halfByte);                   //send command
-                                               //En pulse duration > 450nsec
-    bitClear(halfByte, _lcdToPCF8574[5]);      //RS,RW,E=0,DB3,DB2,DB1,DB0,BCK_LED=0
-    _writePCF8574(halfByte);                   //execute command
+    if (_read(LCD_BUSY_FLAG_READ) != testAddress[i]) {return false;}             //BF=1 or wrong address
   }
 
-  delayMicroseconds(LCD_COMMAND_DELAY);        //command duration, see NOTE
+  _send(LCD_INSTRUCTION_WRITE, (LCD_DDRAM_ADDR_SET | ddramAddress), LCD_CMD_LENGTH_8BIT); //restore cursor position
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    _setSpeed()
+
+    Changes I2C speed & timing which depends on it
+
+    NOTE:
+    - LCD command duration is kept, only padding between characters is
+      recalculated, see "_setTiming()"
+
+    - returns false if bus refused speed
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::_setSpeed(uint32_t speed)
+{
+  if (_bus->begin(speed) != true) {return false;}
+
+  _i2cSpeed = speed;
+
+  _busCommandTime = (1 + (3 * LCD_I2C_BIT_PER_BYTE)) * (1000000UL / speed); //START, address, E=1 & E=0 bytes of the next command, in usec
+
+  _setTiming(_commandDelay, _homeClearDelay);
+
+  return true;
 }
 
 
@@ -899,6 +2358,9 @@ void LiquidCrystal_I2C::_send(uint8_t mode, uint8_t value, uint8_t cmdLength)
 
     - "switch-case" is 32usec faster than
       "bitWrite(data, _lcdToPCF8574[i], bitRead(value, i));"
+
+    - called by constructor only, to build data nibbles & modes lookup
+      tables for "_encode()"
 */
 /**************************************************************************/
 uint8_t LiquidCrystal_I2C::_portMapping(uint8_t value)
@@ -920,6 +2382,93 @@ uint8_t LiquidCrystal_I2C::_portMapping(uint8_t value)
 }
 
 
+/**************************************************************************/
+/*
+    _decode()
+
+    Converts PCF8574 port values to DB7..DB4 nibble, see "_read()"
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C::_decode(uint8_t portValue)
+{
+  uint8_t value = 0;
+
+  value |= bitRead(portValue, _lcdToPCF8574[4]) << 3; //DB7
+  value |= bitRead(portValue, _lcdToPCF8574[3]) << 2; //DB6
+  value |= bitRead(portValue, _lcdToPCF8574[2]) << 1; //DB5
+  value |= bitRead(portValue, _lcdToPCF8574[1]);      //DB4
+
+  return value;
+}
+
+
+/**************************************************************************/
+/*
+    _backlightPort()
+
+    Returns PCF8574 port of backlight pin, see "_setBacklight()"
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C::_backlightPort()
+{
+  return _lcdToPCF8574[0];
+}
+
+
+/**************************************************************************/
+/*
+    _wait()
+
+    Waits for command execution
+
+    NOTE:
+    - duration, worst case command duration in microseconds
+    - see "setPacing()" for details
+    - no wait with command queue, see "tick()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Base::_wait(uint16_t duration)
+{
+  if (_queue != NULL) {return;}                                     //command duration handled by "tick()"
+
+  if (_pacing == LCD_PACING_BUSY_FLAG)
+  {
+    if (duration <= _busCommandTime) {return;}                      //the next I2C transaction is slower than LCD
+
+    duration -= _busCommandTime;
+
+    if (duration <= (8 * _busCommandTime))                          //BF read takes 5 I2C transactions, faster to wait
+    {
+      _stats.pacingTime += duration;
+
+      delayMicroseconds(duration);
+
+      return;
+    }
+
+    uint32_t startTime = micros();
+
+    while (_readBusyFlag() == true)
+    {
+      if ((micros() - startTime) > LCD_BUSY_FLAG_TIMEOUT)           //BF stuck, fall back to fixed delays
+      {
+        _pacing = LCD_PACING_DELAY;
+
+        return;                                                     //timeout is longer than any command duration
+      }
+    }
+
+    return;
+  }
+
+  _stats.pacingTime += duration;
+
+  if (duration >= 1000) {delay(duration / 1000);}                  //"delay()" calls "yield()" on ESP8266 & ESP32
+
+  delayMicroseconds(duration % 1000);
+}
+
+
 /**************************************************************************/
 /*
     _writePCF8574()
@@ -935,13 +2484,43 @@ uint8_t LiquidCrystal_I2C::_portMapping(uint8_t value)
       - 4, other error
 */
 /**************************************************************************/
-void LiquidCrystal_I2C::_writePCF8574(uint8_t value)
+uint8_t LiquidCrystal_I2C_Base::_writePCF8574(uint8_t value)
+{
+  return _writePCF8574(&value, 1);
+}
+
+
+/**************************************************************************/
+/*
+    _writePCF8574()
+
+    Mix backlight with data & writes it to PCF8574 in one I2C transaction
+
+    NOTE:
+    - PCF8574 updates ports after each received byte
+    - length must be <= "LCD_I2C_BUFFER_LENGTH"
+    - see "_writePCF8574(uint8_t value)" for details
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Base::_writePCF8574(const uint8_t *data, uint8_t length)
 {
-  Wire.beginTransmission(_pcf8574Address);
+  uint8_t buffer[LCD_I2C_BUFFER_LENGTH];
+
+  if (length > LCD_I2C_BUFFER_LENGTH) {length = LCD_I2C_BUFFER_LENGTH;} //safety check, see NOTE
+
+  for (uint8_t i = 0; i < length; i++)
+  {
+    buffer[i] = data[i] | _backlightValue; //mix backlight with data
+  }
+
+  uint8_t status = _bus->write(_pcf8574Address, buffer, length);
 
-  Wire.write(value | _backlightValue);     //mix backlight with data & write it to "wire.h" txBuffer
+  _stats.transactions++;
+  _stats.bytes += length;
 
-  Wire.endTransmission(true);              //write data from "wire.h" txBuffer to slave, true=send stop after transmission
+  if ((status >= 1) && (status <= 4)) {_stats.errors[status - 1]++; _addressCounter = LCD_ADDRESS_UNKNOWN;} //command may be lost
+
+  return status;
 }
 
 
@@ -958,40 +2537,86 @@ void LiquidCrystal_I2C::_writePCF8574(uint8_t value)
     - if PCF8574 I/O is high before read, than devices has full I/O control
 */
 /**************************************************************************/
-uint8_t LiquidCrystal_I2C::_readPCF8574()
+uint8_t LiquidCrystal_I2C_Base::_readPCF8574()
 {
-  Wire.requestFrom((uint8_t)_pcf8574Address, (uint8_t)1, (uint8_t)true); //read 1-byte from slave to "wire.h" rxBuffer, true=send stop after transmission
+  int16_t value = _bus->read(_pcf8574Address);
+
+  _stats.transactions++;
 
-  if (Wire.available() == 1) {return Wire.read();}                       //check for 1-byte in "wire.h" rxBuffer
-                              return 0x00;
+  if (value >= 0) {return value;}
+
+  _stats.readErrors++;
+
+  return 0x00;
 }
 
 /**************************************************************************/
 /*
-    _readBusyFlag()
+    _read()
 
-    Reads busy flag (BF)
+    Reads 8-bit value from LCD in 4-bit mode
 
     NOTE:
-    - set RS=0 & RW=1 to retrive busy flag
+    - mode:
+      - LCD_BUSY_FLAG_READ, returns Busy Flag (BF) & address counter
+        BF,AC6,AC5,AC4,AC3,AC2,AC1,AC0
+      - LCD_DATA_READ, returns DDRAM or CGRAM data at address counter &
+        increments address counter
 
-    - if PCF8574 I/O is low before read, than low is always returned
-      regardless of the device state connected to it, see Quasi-Bidirectional
-      ports for more details
-    - if PCF8574 I/O is high before read, than devices has full I/O control
+    - set RW=1 & DB7..DB4 input pins to HIGH before read, see
+      Quasi-Bidirectional ports of PCF8574 for more details
 
-    - DB7 = 1, lcd busy
-      DB7 = 0, lcd ready
+    - LCD outputs data only while E=1, so E=1 is written before PCF8574
+      is read & E=0 after, two E pulses for MSB & LSB nibbles
 
     - input value formated as:
       7  6  5  4  3   2   1   0-bit
       RS,RW,E,DB7,DB6,DB5,DB4,BCK_LED
-      RS,RW,E,DB3,DB2,DB1,DB0,BCK_LED
 */
 /**************************************************************************/
-bool LiquidCrystal_I2C::_readBusyFlag()
+uint8_t LiquidCrystal_I2C_Base::_read(uint8_t mode)
+{
+  uint8_t data[3];
+  uint8_t value = 0;
+
+  _encode(mode, 0xFF, LCD_CMD_LENGTH_4BIT, data);       //RS,RW=1,E=1,DB7=1,DB6=1,DB5=1,DB4=1,BCK_LED=0 & same with E=0
+
+  data[2] = data[0];                                    //RS,RW=1,E=1,DB7=1,DB6=1,DB5=1,DB4=1,BCK_LED=0
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    _writePCF8574(&data[i], i + 1);                     //1-st nibble E=1, 2-nd nibble E=0 & E=1
+
+    value <<= 4;                                        //MSB nibble first
+    value  |= _decode(_readPCF8574());                  //DB7,DB6,DB5,DB4
+  }
+
+  data[2] = PCF8574_PORTS_LOW;                          //RS=0,RW=0,E=0,DB7=0,DB6=0,DB5=0,DB4=0,BCK_LED=0
+
+  _writePCF8574(&data[1], 2);                           //E=0 & RW=0 after E falling edge
+
+  if (mode == LCD_DATA_READ) {_trackData(1);}           //address counter increments after data read
+
+  return value;
+}
+
+
+/**************************************************************************/
+/*
+    _readBusyFlag()
+
+    Reads busy flag (BF)
+
+    NOTE:
+    - DB7 = 1, lcd busy
+      DB7 = 0, lcd ready
+
+    - see "_read()" for details
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Base::_readBusyFlag()
 {
-  _send(LCD_BUSY_FLAG_READ, PCF8574_LCD_DATA_HIGH, LCD_CMD_LENGTH_4BIT); //set RS=0, RW=1 & input pins to HIGH, see NOTE
+  _stats.busyFlagPolls++;
 
-  return bitRead(_readPCF8574(), _lcdToPCF8574[4]);
+  return bitRead(_read(LCD_BUSY_FLAG_READ), 7);
 }
@@ -49,7 +49,12 @@
 #define LiquidCrystal_I2C_h
 
 #include <Arduino.h>
+
+#if defined (ARDUINO)
 #include <Wire.h>
+#endif
+
+#include "LiquidCrystal_I2C_Bus.h"
 
 #if defined (ARDUINO_ARCH_AVR)
 #include <avr/pgmspace.h>          //for Arduino AVR PROGMEM support
@@ -134,8 +139,38 @@
 #define LCD_CMD_LENGTH_4BIT      4      //4-bit command length
 #define LCD_COLUMNS_SIZE         16     //default number of columns
 #define LCD_ROWS_SIZE            2      //default number of rows
+#define LCD_MAX_COLUMNS          40     //maximum number of columns, HD44780 DDRAM row length
 #define LCD_I2C_SPEED            100000 //default I2C speed 100KHz..400KHz, in Hz
 #define LCD_I2C_ACK_STRETCH      1000   //default I2C stretch time, in microseconds
+#define LCD_I2C_BIT_PER_BYTE     9      //8-bit data + ACK/NACK, in I2C clock cycles
+#define LCD_BUSY_FLAG_TIMEOUT    5000   //busy flag polling timeout, in microseconds
+#define LCD_CALIBRATION_SAMPLES  8      //measurements per command type, see "calibrateTiming()"
+#define LCD_CALIBRATION_MARGIN   15     //safety margin added to measured command duration, in %
+#define LCD_CALIBRATION_STEP     20     //"clear()" & "home()" measurement resolution, in microseconds
+#define LCD_BEGIN_CALIBRATE      0x01   //"begin()" option, measure command duration of this LCD
+#define LCD_BEGIN_WARM           0x02   //"begin()" option, skip power-on delay & reset if LCD is already in 4-bit mode
+#define LCD_BEGIN_KEEP_TEXT      0x04   //"begin()" option, keep screen contents after warm restart
+#define LCD_BEGIN_TUNE_SPEED     0x08   //"begin()" option, select the fastest I2C speed verified by DDRAM readback
+#define LCD_SPEED_TUNE_ROUNDS    4      //readback rounds per I2C speed, see "tuneSpeed()"
+#define LCD_SPEED_TUNE_MARGIN    25     //I2C speed is verified faster than selected, in %
+#define LCD_SPEED_TUNE_ADDRESS   0x20   //DDRAM test area, 8-bytes saved & restored, see "tuneSpeed()"
+#define LCD_SPACE_SYMBOL         0x20   //space symbol from LCD ROM, see p.17 & p.30 of HD44780 datasheet
+#define LCD_ADDRESS_UNKNOWN      0xFF   //address counter points to CGRAM or can't be tracked
+#define LCD_FLUSH_MERGE_GAP      1      //unchanged cells between two changed runs sent as data instead of new DDRAM address
+
+#define LCD_FRAMEBUFFER_SIZE(columns, rows) (2 * (columns) * (rows)) //new & displayed shadow DDRAM, in bytes
+#define LCD_QUEUE_SIZE(commands)            (2 * (commands))         //queued command/character takes 2-bytes, in bytes
+#define LCD_QUEUE_4BIT                      0x01                     //queued command is 4-bit, mixed with RS,RW,E mode bits
+
+#if defined (I2C_BUFFER_LENGTH)
+#define LCD_I2C_BUFFER_LENGTH    I2C_BUFFER_LENGTH //"wire.h" txBuffer size, ESP8266 & ESP32 128-bytes
+#elif defined (BUFFER_LENGTH)
+#define LCD_I2C_BUFFER_LENGTH    BUFFER_LENGTH     //"wire.h" txBuffer size, AVR & STM32 32-bytes
+#elif defined (__linux__)
+#define LCD_I2C_BUFFER_LENGTH    128               //Linux "i2c-dev" has no txBuffer, size of one I2C_RDWR message
+#else
+#define LCD_I2C_BUFFER_LENGTH    16                //"wire.h" txBuffer size, safe value for unknown cores
+#endif
 
 
 /* PCF8574 misc controls */
@@ -153,6 +188,15 @@ typedef enum : uint8_t
 lcdFontSize;
 
 
+/* LCD pacing, delay between commands */
+typedef enum : uint8_t
+{
+  LCD_PACING_DELAY             = 0x00,  //waits fixed worst case command duration
+  LCD_PACING_BUSY_FLAG         = 0x01   //polls Busy Flag (BF) & sends next command as soon as LCD is ready
+}
+lcdPacing;
+
+
 /* PCF8574 & PCF8574A addresses */
 typedef enum : uint8_t
 {
@@ -186,12 +230,28 @@ typedef enum : uint8_t
 backlightPolarity;
 
 
+/* I2C bus statistics, see "getStats()" */
+typedef struct
+{
+  uint32_t transactions;                //I2C write & read transactions
+  uint32_t bytes;                       //bytes written to PCF8574
+  uint32_t pacingTime;                  //time spent in fixed delays between commands, in microseconds
+  uint32_t busyFlagPolls;               //Busy Flag (BF) reads
+  uint16_t errors[4];                   //failed writes by "Wire.endTransmission()" code 1..4, NACK on address=errors[1]
+  uint16_t readErrors;                  //failed reads
+}
+lcdStats;
 
-class LiquidCrystal_I2C : public Print
+
+
+/*
+   LCD logic without LCD pins to PCF8574 ports mapping
+   NOTE: helpers take any LCD by "LiquidCrystal_I2C_Base &", mapping is done
+         by "LiquidCrystal_I2C" at run time or "LiquidCrystal_I2C_T" at compile time
+*/
+class LiquidCrystal_I2C_Base : public Print
 {
   public:
-   LiquidCrystal_I2C(pcf8574Address = PCF8574_ADDR_A21_A11_A01, uint8_t P0 = 4, uint8_t P1 = 5, uint8_t P2 = 6, uint8_t P3 = 16, uint8_t P4 = 11, uint8_t P5 = 12, uint8_t P6 = 13, uint8_t P7 = 14, backlightPolarity = POSITIVE);
- 
   #if defined (ARDUINO_ARCH_AVR)
    bool begin(uint8_t columns = LCD_COLUMNS_SIZE, uint8_t rows = LCD_ROWS_SIZE, lcdFontSize = LCD_5x8DOTS, uint32_t speed = LCD_I2C_SPEED, uint32_t stretch = LCD_I2C_ACK_STRETCH);
   #elif defined (ARDUINO_ARCH_ESP8266)
@@ -202,8 +262,10 @@ class LiquidCrystal_I2C : public Print
    bool begin(uint8_t columns = LCD_COLUMNS_SIZE, uint8_t rows = LCD_ROWS_SIZE, lcdFontSize = LCD_5x8DOTS, uint32_t sda = SDA, uint32_t scl = SCL, uint32_t speed = LCD_I2C_SPEED);
   #elif defined (ARDUINO_ARCH_SAMD)
    bool begin(uint8_t columns = LCD_COLUMNS_SIZE, uint8_t rows = LCD_ROWS_SIZE, lcdFontSize = LCD_5x8DOTS, uint32_t speed = LCD_I2C_SPEED);
-  #else
+  #elif defined (ARDUINO)
    bool begin(uint8_t columns = LCD_COLUMNS_SIZE, uint8_t rows = LCD_ROWS_SIZE, lcdFontSize = LCD_5x8DOTS);
+  #else
+   bool begin(uint8_t columns = LCD_COLUMNS_SIZE, uint8_t rows = LCD_ROWS_SIZE, lcdFontSize = LCD_5x8DOTS, uint32_t speed = LCD_I2C_SPEED);
   #endif
 
    void clear();
@@ -229,11 +291,41 @@ class LiquidCrystal_I2C : public Print
   #if defined (PROGMEM)
    void createChar(uint8_t cgramAddress, const uint8_t *cgramChar, uint8_t cgramCharSize = 8);
   #endif
+   void writeCGRAM(uint8_t cgramRow, const uint8_t *rows, uint8_t size);
+   void writeDDRAM(uint8_t ddramAddress, const uint8_t *data, uint8_t size);
 
    void noBacklight();
    void backlight();
 
+   bool      setPacing(lcdPacing mode);
+   lcdPacing getPacing();
+
+   lcdStats getStats();
+   void     resetStats();
+
+   void setBeginOptions(uint8_t options);
+   bool calibrateTiming(uint8_t samples = LCD_CALIBRATION_SAMPLES);
+   bool isWarmRestart();
+
+   bool     tuneSpeed(uint8_t rounds = LCD_SPEED_TUNE_ROUNDS);
+   uint32_t getSpeed();
+
+   uint8_t getColumns();
+   uint8_t getRows();
+
    size_t write(uint8_t character);
+   size_t write(const uint8_t *buffer, size_t size);
+   using  Print::write;
+
+   bool enableFramebuffer(uint8_t *buffer, uint16_t size);
+   void disableFramebuffer();
+   void flush();
+   bool isCharacterVisible(uint8_t character);
+
+   bool     enableQueue(uint8_t *buffer, uint16_t size);
+   void     disableQueue();
+   bool     tick(uint8_t maxCommands = 1);
+   uint16_t queueLength();
 
    /************************* !!! bonus function !!! *************************/
    void printHorizontalGraph(char name, uint8_t row, uint16_t setValue, uint16_t maxValue);
@@ -245,7 +337,24 @@ class LiquidCrystal_I2C : public Print
    void setBrightness(uint8_t pin, uint8_t value);
   #endif
 	 
+  protected:
+   LiquidCrystal_I2C_Base(pcf8574Address addr, backlightPolarity polarity);
+   LiquidCrystal_I2C_Base(LiquidCrystal_I2C_Bus &bus, pcf8574Address addr, backlightPolarity polarity);
+
+   bool _pcf8574PortsMaping = true;
+
+           void    _setBacklight(uint8_t value);
+   virtual uint8_t _encode(uint8_t mode, uint8_t value, uint8_t cmdLength, uint8_t *data) = 0;
+   virtual uint8_t _decode(uint8_t portValue) = 0;
+   virtual uint8_t _backlightPort() = 0;
+
   private:
+  #if defined (ARDUINO)
+   LiquidCrystal_I2C_Bus *_bus = &lcdDefaultBus;
+  #else
+   LiquidCrystal_I2C_Bus *_bus = NULL;  //no default bus, see "LiquidCrystal_I2C_Bus"
+  #endif
+
    pcf8574Address    _pcf8574Address;
    lcdFontSize       _lcdFontSize;
    backlightPolarity _backlightPolarity;
@@ -255,15 +364,159 @@ class LiquidCrystal_I2C : public Print
    uint8_t _lcdColumns;
    uint8_t _lcdRows;
    uint8_t _backlightValue;
-   uint8_t _lcdToPCF8574[8];
-   bool    _pcf8574PortsMaping;
+   uint8_t _dataPadding    = 0; //quantity of extra E=0 bytes between characters in one I2C transaction
+
+   lcdPacing _pacing         = LCD_PACING_DELAY;
+   uint16_t  _busCommandTime = 0;  //minimum time before the next I2C transaction executes command, in microseconds
+
+   lcdStats  _stats          = {}; //I2C bus statistics
+
+   uint32_t  _i2cSpeed       = LCD_I2C_SPEED;
+   uint16_t  _commandDelay   = LCD_COMMAND_DELAY;           //command duration of this LCD, in microseconds
+   uint16_t  _homeClearDelay = LCD_HOME_CLEAR_DELAY * 1000; //"clear()" & "home()" duration of this LCD, in microseconds
+   uint8_t   _beginOptions   = 0;
+   bool      _warmRestart    = false;                       //true=last "begin()" found LCD initialized
+
+   uint8_t   _addressCounter = LCD_ADDRESS_UNKNOWN;           //tracked DDRAM address counter, see "_setAddress()"
+   uint8_t   _ddramReturn    = LCD_ADDRESS_UNKNOWN;           //DDRAM address before CGRAM write, see "_restoreAddress()"
+
+   uint8_t *_framebuffer   = NULL; //shadow DDRAM, "columns * rows" new characters followed by displayed characters
+   bool     _flushAll      = false;
+   uint8_t  _cursorColumn  = 0;    //framebuffer cursor position
+   uint8_t  _cursorRow     = 0;
+
+   uint8_t *_queue         = NULL; //ring buffer of mode & value pairs
+   uint16_t _queueSize     = 0;    //in commands
+   uint16_t _queueHead     = 0;
+   uint16_t _queueCount    = 0;
+   uint32_t _queueTime     = 0;    //last command sent time, in microseconds
+   uint16_t _queueDelay    = 0;    //last command duration, in microseconds
 
          void    _initialization();
          void    _send(uint8_t mode, uint8_t value, uint8_t cmdLength);
-  inline uint8_t _portMapping(uint8_t value);
-         void    _writePCF8574(uint8_t value);
+         void    _sendData(const uint8_t *data, size_t size, bool flash);
+         uint8_t _ddramAddress(uint8_t column, uint8_t row);
+         void    _setAddress(uint8_t ddramAddress);
+         void    _restoreAddress(bool cursorOnly);
+         void    _trackCommand(uint8_t command);
+         void    _trackData(size_t size);
+         void    _bufferWrite(uint8_t character);
+         void    _queuePush(uint8_t mode, uint8_t value);
+         void    _setTiming(uint16_t commandDelay, uint16_t homeClearDelay);
+         bool    _checkTiming(uint8_t samples, uint8_t ddramAddress);
+         bool    _setSpeed(uint32_t speed);
+         bool    _checkAddressCounter();
+         void    _wait(uint16_t duration);
+         uint8_t _writePCF8574(uint8_t value);
+         uint8_t _writePCF8574(const uint8_t *data, uint8_t length);
          uint8_t _readPCF8574();
+         uint8_t _read(uint8_t mode);
          bool    _readBusyFlag();
 };
 
+
+
+/*
+   LCD pins to PCF8574 ports mapping, resolved at run time
+   NOTE: mapping & lookup tables of "_encode()" are stored in each object
+*/
+class LiquidCrystal_I2C : public LiquidCrystal_I2C_Base
+{
+  public:
+  #if defined (ARDUINO)
+   LiquidCrystal_I2C(pcf8574Address = PCF8574_ADDR_A21_A11_A01, uint8_t P0 = 4, uint8_t P1 = 5, uint8_t P2 = 6, uint8_t P3 = 16, uint8_t P4 = 11, uint8_t P5 = 12, uint8_t P6 = 13, uint8_t P7 = 14, backlightPolarity = POSITIVE);
+  #endif
+   LiquidCrystal_I2C(LiquidCrystal_I2C_Bus &bus, pcf8574Address = PCF8574_ADDR_A21_A11_A01, uint8_t P0 = 4, uint8_t P1 = 5, uint8_t P2 = 6, uint8_t P3 = 16, uint8_t P4 = 11, uint8_t P5 = 12, uint8_t P6 = 13, uint8_t P7 = 14, backlightPolarity = POSITIVE);
+
+  protected:
+   uint8_t _encode(uint8_t mode, uint8_t value, uint8_t cmdLength, uint8_t *data);
+   uint8_t _decode(uint8_t portValue);
+   uint8_t _backlightPort();
+
+  private:
+   uint8_t _lcdToPCF8574[8];
+   uint8_t _nibbleToPCF8574[16]; //DB7..DB4 nibble to PCF8574 ports lookup table
+   uint8_t _modeToPCF8574[8];    //RS,RW,E mode to PCF8574 ports lookup table
+   uint8_t _enPCF8574;           //E pin PCF8574 port mask
+
+   void    _portsInitialization(const uint8_t *pcf8574ToLCD);
+   uint8_t _portMapping(uint8_t value);
+};
+
+
+
+/*
+   LCD pins to PCF8574 ports mapping, resolved at compile time
+   NOTE: P0..P7 are LCD pins connected to PCF8574 ports P0..P7, same as "LiquidCrystal_I2C()" constructor
+*/
+template <uint8_t P0, uint8_t P1, uint8_t P2, uint8_t P3, uint8_t P4, uint8_t P5, uint8_t P6, uint8_t P7>
+struct LiquidCrystal_I2C_PinMap
+{
+  static constexpr uint8_t count(uint8_t lcdPin) {return (P0 == lcdPin) + (P1 == lcdPin) + (P2 == lcdPin) + (P3 == lcdPin) + (P4 == lcdPin) + (P5 == lcdPin) + (P6 == lcdPin) + (P7 == lcdPin);}
+
+  static constexpr uint8_t port(uint8_t lcdPin)  {return (P0 == lcdPin) ? 0 : (P1 == lcdPin) ? 1 : (P2 == lcdPin) ? 2 : (P3 == lcdPin) ? 3 : (P4 == lcdPin) ? 4 : (P5 == lcdPin) ? 5 : (P6 == lcdPin) ? 6 : 7;}
+
+  static constexpr uint8_t mask(uint8_t lcdPin)  {return 0x01 << port(lcdPin);}
+
+  static constexpr bool    valid()               {return (count(4) == 1) && (count(5) == 1) && (count(6) == 1) && (count(16) == 1) && (count(11) == 1) && (count(12) == 1) && (count(13) == 1) && (count(14) == 1);}
+};
+
+
+/*
+   LiquidCrystal_I2C with LCD pins to PCF8574 ports mapping fixed at compile time
+   NOTE: wrong pins declaration fails to compile, instead of "begin()" returning false
+         PCF8574 port masks are constants, object has no mapping & lookup tables
+         LiquidCrystal_I2C_T<4, 5, 6, 16, 11, 12, 13, 14, POSITIVE> lcd(PCF8574_ADDR_A21_A11_A01);
+         LiquidCrystal_I2C_T<4, 5, 6, 16, 11, 12, 13, 14, POSITIVE> lcd(bus, PCF8574_ADDR_A21_A11_A01);
+*/
+template <uint8_t P0 = 4, uint8_t P1 = 5, uint8_t P2 = 6, uint8_t P3 = 16, uint8_t P4 = 11, uint8_t P5 = 12, uint8_t P6 = 13, uint8_t P7 = 14, backlightPolarity POLARITY = POSITIVE>
+class LiquidCrystal_I2C_T : public LiquidCrystal_I2C_Base
+{
+  typedef LiquidCrystal_I2C_PinMap<P0, P1, P2, P3, P4, P5, P6, P7> pinMap;
+
+  static_assert(pinMap::valid(), "wrong LCD pins declaration, only pins numbers 4,5,6,16,11,12,13,14 are legal & each pin must be used once");
+
+  static constexpr uint8_t _rsPCF8574  = pinMap::mask(4);  //RS  pin PCF8574 port mask
+  static constexpr uint8_t _rwPCF8574  = pinMap::mask(5);  //RW  pin PCF8574 port mask
+  static constexpr uint8_t _enPCF8574  = pinMap::mask(6);  //E   pin PCF8574 port mask
+  static constexpr uint8_t _db4PCF8574 = pinMap::mask(11); //DB4 pin PCF8574 port mask
+  static constexpr uint8_t _db5PCF8574 = pinMap::mask(12); //DB5 pin PCF8574 port mask
+  static constexpr uint8_t _db6PCF8574 = pinMap::mask(13); //DB6 pin PCF8574 port mask
+  static constexpr uint8_t _db7PCF8574 = pinMap::mask(14); //DB7 pin PCF8574 port mask
+
+  public:
+  #if defined (ARDUINO)
+   LiquidCrystal_I2C_T(pcf8574Address addr = PCF8574_ADDR_A21_A11_A01) : LiquidCrystal_I2C_Base(addr, POLARITY) {_setBacklight(LCD_BACKLIGHT_ON);}
+  #endif
+   LiquidCrystal_I2C_T(LiquidCrystal_I2C_Bus &bus, pcf8574Address addr = PCF8574_ADDR_A21_A11_A01) : LiquidCrystal_I2C_Base(bus, addr, POLARITY) {_setBacklight(LCD_BACKLIGHT_ON);}
+
+  protected:
+   /* same as "LiquidCrystal_I2C::_encode()", port masks instead of lookup tables */
+   uint8_t _encode(uint8_t mode, uint8_t value, uint8_t cmdLength, uint8_t *data)
+   {
+     mode    = _mode(mode);                    //RS,RW,E=1 mapped to PCF8574 ports
+
+     data[0] = mode | _nibble(value >> 4);     //RS,RW,E=1,DB7,DB6,DB5,DB4,BCK_LED=0, send command
+     data[1] = data[0] & ~_enPCF8574;          //RS,RW,E=0,DB7,DB6,DB5,DB4,BCK_LED=0, execute command
+
+     if (cmdLength == LCD_CMD_LENGTH_4BIT) {return 2;}
+
+     data[2] = mode | _nibble(value & 0x0F);   //RS,RW,E=1,DB3,DB2,DB1,DB0,BCK_LED=0, send command
+     data[3] = data[2] & ~_enPCF8574;          //RS,RW,E=0,DB3,DB2,DB1,DB0,BCK_LED=0, execute command
+
+     return 4;
+   }
+
+   uint8_t _decode(uint8_t portValue)
+   {
+     return (((portValue & _db7PCF8574) != 0) << 3) | (((portValue & _db6PCF8574) != 0) << 2) | (((portValue & _db5PCF8574) != 0) << 1) | ((portValue & _db4PCF8574) != 0);
+   }
+
+   uint8_t _backlightPort() {return pinMap::port(16);}
+
+  private:
+   static uint8_t _mode(uint8_t mode)     {return ((mode & 0x80) ? _rsPCF8574 : 0) | ((mode & 0x40) ? _rwPCF8574 : 0) | ((mode & 0x20) ? _enPCF8574 : 0);}
+   static uint8_t _nibble(uint8_t nibble) {return ((nibble & 0x08) ? _db7PCF8574 : 0) | ((nibble & 0x04) ? _db6PCF8574 : 0) | ((nibble & 0x02) ? _db5PCF8574 : 0) | ((nibble & 0x01) ? _db4PCF8574 : 0);}
+};
+
 #endif
@@ -0,0 +1,190 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - spinners & blinking icons animated by rewriting one CGRAM slot,
+     every character on the screen with this code changes at once
+   - DDRAM isn't written, text updates & user cursor aren't disturbed
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Animation.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Animation()
+
+    Constructor. Defines CGRAM slot, frames & frame time
+
+    NOTE:
+    - "frames" is array of "frameCount * 8" rows, stored in MCU flash
+      memory with PROGMEM, e.g.
+        const uint8_t spinner[][8] PROGMEM = {{...}, {...}};
+        LiquidCrystal_I2C_Animation busy(lcd, 0, spinner[0], 4);
+
+    - print character "slot" anywhere on the screen with "write(slot)"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Animation::LiquidCrystal_I2C_Animation(LiquidCrystal_I2C_Base &lcd, uint8_t slot, const uint8_t *frames, uint8_t frameCount, uint16_t interval) : _lcd(lcd)
+{
+  _frames     = frames;
+  _slot       = slot & 0x07;                                        //5x8 dots CGRAM has 8 slots
+  _frameCount = (frameCount > 0) ? frameCount : 1;
+  _frame      = 0;
+  _interval   = interval;
+  _lastFrame  = 0;
+  _playing    = true;
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Uploads the 1-st frame to CGRAM & starts animation
+
+    NOTE:
+    - call after "LiquidCrystal_I2C::begin()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Animation::begin()
+{
+  _frame     = 0;
+  _playing   = true;
+  _lastFrame = millis();
+
+  _upload();
+}
+
+
+/**************************************************************************/
+/*
+    tick()
+
+    Uploads the next frame if frame time is elapsed, returns true if
+    frame was changed
+
+    NOTE:
+    - doesn't block, call from "loop()" as often as possible
+
+    - one frame costs CGRAM address command & 8 rows regardless of
+      quantity of characters showing it
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Animation::tick()
+{
+  if ((_playing == false) || (_frameCount < 2))      {return false;}
+  if ((millis() - _lastFrame) < _interval)           {return false;}
+
+  _lastFrame = millis();
+
+  _frame = (_frame + 1) % _frameCount;
+
+  _upload();
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    play()
+
+    Resumes animation from the current frame
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Animation::play()
+{
+  if (_playing == true) {return;}
+
+  _playing   = true;
+  _lastFrame = millis();
+}
+
+
+/**************************************************************************/
+/*
+    pause()
+
+    Stops animation at the current frame
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Animation::pause()
+{
+  _playing = false;
+}
+
+
+/**************************************************************************/
+/*
+    setFrame()
+
+    Shows frame now, e.g. blank frame of blinking icon after "pause()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Animation::setFrame(uint8_t frame)
+{
+  _frame     = frame % _frameCount;
+  _lastFrame = millis();
+
+  _upload();
+}
+
+
+/**************************************************************************/
+/*
+    setInterval()
+
+    Sets frame time, in msec
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Animation::setInterval(uint16_t interval)
+{
+  _interval = interval;
+}
+
+
+/**************************************************************************/
+/*
+    getFrame()
+
+    Returns current frame
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Animation::getFrame()
+{
+  return _frame;
+}
+
+
+/**************************************************************************/
+/*
+    _upload()
+
+    Writes current frame to CGRAM slot
+
+    NOTE:
+    - DDRAM address is restored by "LiquidCrystal_I2C", so user cursor
+      & the next "print()" aren't disturbed
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Animation::_upload()
+{
+  const uint8_t *frame = &_frames[(uint16_t)_frame * LCD_ANIMATION_ROWS];
+
+  #if defined (PROGMEM)
+  _lcd.createChar(_slot, frame, LCD_ANIMATION_ROWS);                      //rows from MCU flash memory
+  #else
+  _lcd.writeCGRAM(_slot * LCD_ANIMATION_ROWS, frame, LCD_ANIMATION_ROWS);
+  #endif
+}
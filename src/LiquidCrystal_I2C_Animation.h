@@ -0,0 +1,57 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - spinners & blinking icons animated by rewriting one CGRAM slot,
+     every character on the screen with this code changes at once
+   - DDRAM isn't written, text updates & user cursor aren't disturbed
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Animation_h
+#define LiquidCrystal_I2C_Animation_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_ANIMATION_ROWS       8      //5x8 dots frame size, in rows
+#define LCD_ANIMATION_INTERVAL   200    //default frame time, in msec
+
+
+class LiquidCrystal_I2C_Animation
+{
+  public:
+   LiquidCrystal_I2C_Animation(LiquidCrystal_I2C_Base &lcd, uint8_t slot, const uint8_t *frames, uint8_t frameCount, uint16_t interval = LCD_ANIMATION_INTERVAL);
+
+   void    begin();
+   bool    tick();
+   void    play();
+   void    pause();
+   void    setFrame(uint8_t frame);
+   void    setInterval(uint16_t interval);
+   uint8_t getFrame();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   const uint8_t *_frames;                                                          //"frameCount * 8" rows, MCU flash memory if PROGMEM is supported
+   uint8_t        _slot;
+   uint8_t        _frameCount;
+   uint8_t        _frame;
+   uint16_t       _interval;
+   uint32_t       _lastFrame;
+   bool           _playing;
+
+   void _upload();
+};
+
+#endif
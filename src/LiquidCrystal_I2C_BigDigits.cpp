@@ -0,0 +1,235 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - big digits 3 characters wide & 2 or 3 rows high
+   - digits are made of 8 segments 5x8 dots custom characters, takes all
+     CGRAM slots
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_BigDigits.h"
+
+#define LCD_BIG_FULL   0xFF             //"solid square" symbol from LCD ROM, see p.17 & p.30 of HD44780 datasheet
+#define LCD_BIG_SPACE  LCD_SPACE_SYMBOL
+
+
+/* segments, CGRAM slots 0..7 */
+#if defined (PROGMEM)
+static const uint8_t bigSegment[8][8] PROGMEM =
+#else
+static const uint8_t bigSegment[8][8] =
+#endif
+{
+  {0x07, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, //0, rounded left top
+  {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00}, //1, upper bar
+  {0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F}, //2, rounded right top
+  {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0F, 0x07}, //3, rounded left bottom
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F}, //4, lower bar
+  {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C}, //5, rounded right bottom
+  {0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F}, //6, upper & middle bars
+  {0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F}  //7, thin upper & lower bars
+};
+
+/* 2-rows digits 0..9 & blank, top row then bottom row */
+#if defined (PROGMEM)
+static const uint8_t bigDigit2[11][2 * LCD_BIG_DIGIT_WIDTH] PROGMEM =
+#else
+static const uint8_t bigDigit2[11][2 * LCD_BIG_DIGIT_WIDTH] =
+#endif
+{
+  {0,            1,            2,            3,            4,            5},
+  {1,            2,            LCD_BIG_SPACE, 4,            LCD_BIG_FULL, 4},
+  {6,            6,            2,            3,            4,            4},
+  {6,            6,            2,            4,            4,            5},
+  {3,            4,            LCD_BIG_FULL, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL},
+  {LCD_BIG_FULL, 6,            6,            4,            4,            5},
+  {0,            6,            6,            3,            4,            5},
+  {1,            1,            2,            LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL},
+  {0,            6,            2,            3,            4,            5},
+  {0,            6,            2,            LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL},
+  {LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE}
+};
+
+/* 3-rows digits 0..9 & blank, top row, middle row then bottom row */
+#if defined (PROGMEM)
+static const uint8_t bigDigit3[11][3 * LCD_BIG_DIGIT_WIDTH] PROGMEM =
+#else
+static const uint8_t bigDigit3[11][3 * LCD_BIG_DIGIT_WIDTH] =
+#endif
+{
+  {0,            1,            2,            LCD_BIG_FULL, LCD_BIG_SPACE, LCD_BIG_FULL, 3,            4,            5},
+  {1,            2,            LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL, LCD_BIG_SPACE, 4,            LCD_BIG_FULL, 4},
+  {1,            1,            2,            0,            7,            7,            3,            4,            4},
+  {1,            1,            2,            LCD_BIG_SPACE, 7,            LCD_BIG_FULL, 4,            4,            5},
+  {LCD_BIG_FULL, LCD_BIG_SPACE, LCD_BIG_FULL, 3,            4,            LCD_BIG_FULL, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL},
+  {LCD_BIG_FULL, 1,            1,            7,            7,            2,            4,            4,            5},
+  {0,            1,            1,            LCD_BIG_FULL, 7,            2,            3,            4,            5},
+  {1,            1,            2,            LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_FULL},
+  {0,            1,            2,            LCD_BIG_FULL, 7,            LCD_BIG_FULL, 3,            4,            5},
+  {0,            1,            2,            3,            4,            LCD_BIG_FULL, 4,            4,            5},
+  {LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE, LCD_BIG_SPACE}
+};
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_BigDigits()
+
+    Constructor. Defines position, number of digits & digit height
+
+    NOTE:
+    - column & row are the left top character of the first digit
+
+    - every digit takes 3 columns + 1 column space, 20x4 LCD
+      fits 5 digits
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_BigDigits::LiquidCrystal_I2C_BigDigits(LiquidCrystal_I2C_Base &lcd, uint8_t column, uint8_t row, uint8_t digits, uint8_t height) : _lcd(lcd)
+{
+  _column = column;
+  _row    = row;
+  _digits    = constrain(digits, 1, LCD_BIG_DIGIT_MAX);
+  _positions = _digits;
+  _height    = (height == 3) ? 3 : 2;               //safety check, 2 or 3 rows only
+
+  invalidate();
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Uploads segments to CGRAM & blanks all digit positions
+
+    NOTE:
+    - call after "LiquidCrystal_I2C::begin()", segments take all 8
+      CGRAM slots, don't use "createChar()" with big digits
+
+    - digits which don't fit into columns & rows of the screen are
+      dropped from the left, last digit needs no space after it
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_BigDigits::begin()
+{
+  uint8_t segment[8];
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    #if defined (PROGMEM)
+    for (uint8_t j = 0; j < 8; j++) {segment[j] = pgm_read_byte(&bigSegment[i][j]);}
+    #else
+    for (uint8_t j = 0; j < 8; j++) {segment[j] = bigSegment[i][j];}
+    #endif
+
+    _lcd.createChar(i, segment);
+  }
+
+  _positions = 0;
+
+  if (((_row + _height) <= _lcd.getRows()) && ((_column + LCD_BIG_DIGIT_WIDTH) <= _lcd.getColumns())) //digits fit into the screen
+  {
+    _positions = ((_lcd.getColumns() - _column - LCD_BIG_DIGIT_WIDTH) / LCD_BIG_DIGIT_PITCH) + 1;
+
+    if (_positions > _digits) {_positions = _digits;}
+  }
+
+  invalidate();
+
+  for (uint8_t i = 0; i < _positions; i++) {printDigit(i, LCD_BIG_DIGIT_BLANK);}
+}
+
+
+/**************************************************************************/
+/*
+    print()
+
+    Prints number right aligned
+
+    NOTE:
+    - only digits which differ from previous number are redrawn,
+      counter & clock cost 1 digit most of the time
+
+    - number is cut to the last digits if it doesn't fit into digit
+      positions or the screen, see "begin()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_BigDigits::print(uint32_t value, bool leadingZeros)
+{
+  for (int8_t i = _positions - 1; i >= 0; i--)
+  {
+    printDigit(i, value % 10);
+
+    value = value / 10;
+
+    if ((value == 0) && (leadingZeros == false))
+    {
+      while (--i >= 0) {printDigit(i, LCD_BIG_DIGIT_BLANK);}
+    }
+  }
+}
+
+
+/**************************************************************************/
+/*
+    printDigit()
+
+    Prints digit 0..9 or LCD_BIG_DIGIT_BLANK at the position
+
+    NOTE:
+    - nothing is sent if the same digit is already drawn
+
+    - every row of the digit costs one DDRAM address & 3 characters
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_BigDigits::printDigit(uint8_t position, uint8_t digit)
+{
+  if (position >= _positions)    {return;}                  //safety check, position out of range or off the screen
+  if (digit > LCD_BIG_DIGIT_BLANK) {digit = LCD_BIG_DIGIT_BLANK;}
+  if (_shown[position] == digit) {return;}
+
+  uint8_t cells[LCD_BIG_DIGIT_WIDTH];
+
+  for (uint8_t r = 0; r < _height; r++)
+  {
+    for (uint8_t c = 0; c < LCD_BIG_DIGIT_WIDTH; c++)
+    {
+      #if defined (PROGMEM)
+      cells[c] = (_height == 2) ? pgm_read_byte(&bigDigit2[digit][(r * LCD_BIG_DIGIT_WIDTH) + c]) : pgm_read_byte(&bigDigit3[digit][(r * LCD_BIG_DIGIT_WIDTH) + c]);
+      #else
+      cells[c] = (_height == 2) ? bigDigit2[digit][(r * LCD_BIG_DIGIT_WIDTH) + c] : bigDigit3[digit][(r * LCD_BIG_DIGIT_WIDTH) + c];
+      #endif
+    }
+
+    _lcd.setCursor(_column + (position * LCD_BIG_DIGIT_PITCH), _row + r);
+    _lcd.write(cells, LCD_BIG_DIGIT_WIDTH);
+  }
+
+  _shown[position] = digit;
+}
+
+
+/**************************************************************************/
+/*
+    invalidate()
+
+    Forgets drawn digits, next "print()" redraws all digits
+
+    NOTE:
+    - call after "clear()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_BigDigits::invalidate()
+{
+  memset(_shown, LCD_BIG_DIGIT_UNKNOWN, sizeof(_shown));
+}
@@ -0,0 +1,54 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - big digits 3 characters wide & 2 or 3 rows high
+   - digits are made of 8 segments 5x8 dots custom characters, takes all
+     CGRAM slots
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_BigDigits_h
+#define LiquidCrystal_I2C_BigDigits_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_BIG_DIGIT_WIDTH      3      //digit width, in characters
+#define LCD_BIG_DIGIT_PITCH      4      //digit width + 1 space between digits, in characters
+#define LCD_BIG_DIGIT_MAX        10     //maximum number of digits, 40 columns DDRAM row
+#define LCD_BIG_DIGIT_BLANK      10     //empty digit position
+#define LCD_BIG_DIGIT_UNKNOWN    0xFF   //digit position contents is unknown
+
+
+class LiquidCrystal_I2C_BigDigits
+{
+  public:
+   LiquidCrystal_I2C_BigDigits(LiquidCrystal_I2C_Base &lcd, uint8_t column, uint8_t row, uint8_t digits, uint8_t height = 2);
+
+   void begin();
+   void print(uint32_t value, bool leadingZeros = false);
+   void printDigit(uint8_t position, uint8_t digit);
+   void invalidate();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   uint8_t _column;
+   uint8_t _row;
+   uint8_t _digits;
+   uint8_t _positions;                //digits which fit into the screen, see "begin()"
+   uint8_t _height;
+   uint8_t _shown[LCD_BIG_DIGIT_MAX]; //drawn digits
+};
+
+#endif
@@ -0,0 +1,132 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - I2C bus backends, LCD talks to PCF8574 only through this interface
+   - "LiquidCrystal_I2C_TwoWire" for any Arduino "TwoWire" bus: Wire, Wire1 & etc.
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Bus.h"
+
+
+#if defined (ARDUINO)
+LiquidCrystal_I2C_TwoWire lcdDefaultBus(Wire);
+#endif
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Prepares bus for LCD
+
+    NOTE:
+    - called by "LiquidCrystal_I2C::begin()" for every bus except
+      "lcdDefaultBus", bus must be started before
+
+    - returns false if bus can't be used
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Bus::begin(uint32_t speed)
+{
+  (void)speed;
+
+  return true;
+}
+
+
+#if defined (ARDUINO)
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_TwoWire()
+
+    Constructor. Wraps Arduino "TwoWire" bus
+
+    NOTE:
+    - call "wire.begin()" with board specific pins before
+      "LiquidCrystal_I2C::begin()":
+      - Wire1.begin();
+        lcd.begin(20, 4);
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_TwoWire::LiquidCrystal_I2C_TwoWire(TwoWire &wire) : _wire(wire)
+{
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Sets bus speed
+
+    NOTE:
+    - use the same speed in "LiquidCrystal_I2C::begin()", it is used
+      to pack several characters into one I2C transaction
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_TwoWire::begin(uint32_t speed)
+{
+  _wire.setClock(speed);
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Writes data to slave in one I2C transaction
+
+    NOTE:
+    - length must be <= "wire.h" txBuffer size, zero length only checks
+      if slave is connected
+
+    - returned value by "Wire.endTransmission()":
+      - 0, success
+      - 1, data too long to fit in transmit data buffer
+      - 2, received NACK on transmit of address
+      - 3, received NACK on transmit of data
+      - 4, other error
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_TwoWire::write(uint8_t address, const uint8_t *data, uint8_t length)
+{
+  _wire.beginTransmission(address);
+
+  _wire.write(data, length);            //write data to "wire.h" txBuffer
+
+  return _wire.endTransmission(true);   //write data from "wire.h" txBuffer to slave, true=send stop after transmission
+}
+
+
+/**************************************************************************/
+/*
+    read()
+
+    Reads 1-byte from slave
+
+    NOTE:
+    - returns -1 if slave doesn't respond
+*/
+/**************************************************************************/
+int16_t LiquidCrystal_I2C_TwoWire::read(uint8_t address)
+{
+  _wire.requestFrom((uint8_t)address, (uint8_t)1, (uint8_t)true); //read 1-byte from slave to "wire.h" rxBuffer, true=send stop after transmission
+
+  if (_wire.available() == 1) {return _wire.read();}               //check for 1-byte in "wire.h" rxBuffer
+                               return -1;
+}
+
+#endif
@@ -0,0 +1,58 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - I2C bus backends, LCD talks to PCF8574 only through this interface
+   - "LiquidCrystal_I2C_TwoWire" for any Arduino "TwoWire" bus: Wire, Wire1 & etc.
+   - without Arduino core, e.g. Linux, only user backends, no "Wire" & no
+     "lcdDefaultBus", see "extras/linux"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Bus_h
+#define LiquidCrystal_I2C_Bus_h
+
+#include <Arduino.h>
+
+#if defined (ARDUINO)
+#include <Wire.h>
+#endif
+
+
+class LiquidCrystal_I2C_Bus
+{
+  public:
+   virtual bool    begin(uint32_t speed);
+   virtual uint8_t write(uint8_t address, const uint8_t *data, uint8_t length) = 0;
+   virtual int16_t read(uint8_t address) = 0;
+};
+
+
+#if defined (ARDUINO)
+class LiquidCrystal_I2C_TwoWire : public LiquidCrystal_I2C_Bus
+{
+  public:
+   LiquidCrystal_I2C_TwoWire(TwoWire &wire);
+
+   bool    begin(uint32_t speed);
+   uint8_t write(uint8_t address, const uint8_t *data, uint8_t length);
+   int16_t read(uint8_t address);
+
+  private:
+   TwoWire &_wire;
+};
+
+
+extern LiquidCrystal_I2C_TwoWire lcdDefaultBus; //global "Wire", initialized by "LiquidCrystal_I2C::begin()"
+#endif
+
+#endif
@@ -0,0 +1,583 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - I2C bus backend which checks LCD timing against controller datasheet
+   - every PCF8574 byte is time stamped by bus clock, E pulses, setup &
+     hold times & command durations are checked
+   - works as mock bus on host or passes data to another bus
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Checker.h"
+
+#if defined (__GLIBC__)
+#include <execinfo.h>
+#include <stdlib.h>
+#endif
+
+
+/* worst case of datasheet tables, low supply voltage */
+const lcdTimingProfile lcdProfileHD44780 = {"HD44780", 1000, 450, 60, 20, 195, 10, 37, 1520, 40, 4100, 100};
+const lcdTimingProfile lcdProfileKS0066  = {"KS0066",  1000, 450, 60, 20, 195, 10, 39, 1530, 30, 4100, 100};
+const lcdTimingProfile lcdProfileST7066U = {"ST7066U", 1200, 460, 30, 10,  80, 10, 37, 1520, 40, 4100, 100};
+
+static const char *const lcdRuleName[LCD_CHECK_RULES] = {"pulse width", "cycle", "address setup", "address hold", "data setup", "data hold", "busy"};
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Checker()
+
+    Constructor. Defines controller timing, PCF8574 ports of RS, RW, E &
+    DB4 pins
+
+    NOTE:
+    - bus=NULL, mock bus, every byte is ACKed, "read()" returns busy
+      flag from the controller model, runs on host without hardware
+
+    - bus!=NULL, every transaction is checked & passed to this bus:
+      - Wire.begin();
+        LiquidCrystal_I2C_Checker checker(lcdProfileHD44780, &lcdDefaultBus);
+        LiquidCrystal_I2C         lcd(checker);
+
+    - DB5..DB7 must follow DB4, same as in "LiquidCrystal_I2C"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Checker::LiquidCrystal_I2C_Checker(const lcdTimingProfile &profile, LiquidCrystal_I2C_Bus *bus, uint8_t rsPort, uint8_t rwPort, uint8_t enPort, uint8_t db4Port)
+{
+  _profile    = &profile;
+  _bus        = bus;
+  _rsMask     = 0x01 << rsPort;
+  _rwMask     = 0x01 << rwPort;
+  _enMask     = 0x01 << enPort;
+  _dataMask   = 0x0F << db4Port;
+  _db4Port    = db4Port;
+  _bitTime    = 10000;                                                  //100kHz
+  _rules      = LCD_CHECK_ALL;
+  _site       = NULL;
+
+  _clock      = 0;
+  _lastMicros = 0;
+  _busFree    = 0;
+  _powered    = false;
+
+  _port       = 0xFF;                                                   //PCF8574 power-on state, all ports high
+  _pulses     = false;
+  _fourBit    = false;                                                  //controller power-on state, 8-bit interface
+  _writeLow   = false;
+  _highNibble = 0;
+  _readLow    = false;
+  _resetStep  = 0;
+
+  _addressChange = 0;
+  _dataChange    = 0;
+  _enRise        = 0;
+  _enFall        = 0;
+  _commandStart  = 0;
+  _busyUntil     = 0;
+
+  clear();
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Sets bus speed, used to time stamp every PCF8574 byte
+
+    NOTE:
+    - the 1-st call is controller power-on, next command must wait
+      for profile "powerOnTime"
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Checker::begin(uint32_t speed)
+{
+  if (speed == 0) {return false;}
+
+  _bitTime = (1000000000UL + speed - 1) / speed;
+
+  if (_powered == false)
+  {
+    _powered      = true;
+    _commandStart = _now();
+    _busyUntil    = _commandStart + (uint64_t)_profile->powerOnTime * 1000000;
+  }
+
+  if (_bus != NULL) {return _bus->begin(speed);}
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Time stamps & checks every byte of I2C write transaction
+
+    NOTE:
+    - transaction starts when bus is free, START condition & address
+      takes 10 clocks, every byte is latched by PCF8574 on ACK, 9 clocks
+      after previous
+
+    - mock bus holds the caller for transaction time, so "micros()" of
+      the caller & checker time line stay in step
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Checker::write(uint8_t address, const uint8_t *data, uint8_t length)
+{
+  uint64_t start = _now();
+
+  if (start < _busFree) {start = _busFree;}
+
+  _transactions++;
+
+  for (_byte = 0; _byte < length; _byte++)
+  {
+    _portChange(data[_byte], start + (uint64_t)_bitTime * (10 + 9 * (_byte + 1)));
+  }
+
+  _busFree = start + (uint64_t)_bitTime * (10 + 9 * length + 1);        //+STOP
+
+  if (_bus != NULL) {return _bus->write(address, data, length);}
+
+  uint64_t now = _now();
+
+  if (_busFree > now) {delayMicroseconds((_busFree - now + 999) / 1000);}
+
+  return 0;                                                             //mock bus, ACK
+}
+
+
+/**************************************************************************/
+/*
+    read()
+
+    Reads PCF8574 ports
+
+    NOTE:
+    - mock bus returns busy flag (BF) on DB7 & zero address counter,
+      when E=1 & RW=1 & RS=0, and zero data when RS=1
+*/
+/**************************************************************************/
+int16_t LiquidCrystal_I2C_Checker::read(uint8_t address)
+{
+  uint64_t start = _now();
+
+  if (start < _busFree) {start = _busFree;}
+
+  _busFree = start + (uint64_t)_bitTime * (10 + 9 + 1);
+
+  if (_bus != NULL) {return _bus->read(address);}
+
+  uint8_t value = _port | _dataMask;                                    //quasi-bidirectional ports, pulled high
+
+  if (((_port & _enMask) != 0) && ((_port & _rwMask) != 0))
+  {
+    uint8_t full = 0x00;
+
+    if (((_port & _rsMask) == 0) && (start < _busyUntil)) {full = 0x80;}
+
+    uint8_t nibble = ((_fourBit == true) && (_readLow == true)) ? (full & 0x0F) : (full >> 4);
+
+    value = (_port & ~_dataMask) | (nibble << _db4Port);
+  }
+
+  uint64_t now = _now();
+
+  if (_busFree > now) {delayMicroseconds((_busFree - now + 999) / 1000);}
+
+  return value;
+}
+
+
+/**************************************************************************/
+/*
+    setRules()
+
+    Sets checked rules, LCD_CHECK_ALL by default
+
+    NOTE:
+    - "LiquidCrystal_I2C" changes RS & RW in the same PCF8574 byte as E
+      rising edge, address setup is always zero. Exclude LCD_CHECK_ADDRESS_SETUP
+      to see the other rules only:
+      - checker.setRules(LCD_CHECK_ALL & ~LCD_CHECK_ADDRESS_SETUP);
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::setRules(uint8_t rules)
+{
+  _rules = rules & LCD_CHECK_ALL;
+}
+
+
+/**************************************************************************/
+/*
+    mark()
+
+    Labels violations of the following LCD calls
+
+    NOTE:
+    - label must be static string, only pointer is saved
+    - use LCD_CHECKER_MARK(checker) to label with file & line
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::mark(const char *site)
+{
+  _site = site;
+}
+
+
+/**************************************************************************/
+/*
+    getViolations()
+
+    Returns quantity of violations of the rules since "clear()"
+*/
+/**************************************************************************/
+uint32_t LiquidCrystal_I2C_Checker::getViolations(uint8_t rules)
+{
+  uint32_t violations = 0;
+
+  for (uint8_t i = 0; i < LCD_CHECK_RULES; i++)
+  {
+    if ((rules & (0x01 << i)) != 0) {violations += _count[i];}
+  }
+
+  return violations;
+}
+
+
+/**************************************************************************/
+/*
+    clear()
+
+    Clears violations counters, log & transaction counter
+
+    NOTE:
+    - controller model is not reset
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::clear()
+{
+  for (uint8_t i = 0; i < LCD_CHECK_RULES; i++) {_count[i] = 0;}
+
+  _transactions = 0;
+  _byte         = 0;
+  _logHead      = 0;
+  _logCount     = 0;
+}
+
+
+/**************************************************************************/
+/*
+    report()
+
+    Prints violations counters & the last LCD_CHECKER_LOG violations
+
+    NOTE:
+    - measured & limit are in nsec
+    - call stack is printed on glibc only, build with "-rdynamic" to
+      see function names
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::report(Print &out)
+{
+  out.print(_profile->name);
+  out.print(F(" timing, "));
+  out.print(getViolations());
+  out.println(F(" violations"));
+
+  for (uint8_t i = 0; i < LCD_CHECK_RULES; i++)
+  {
+    if (_count[i] == 0) {continue;}
+
+    out.print(F("  "));
+    out.print(lcdRuleName[i]);
+    out.print(F(": "));
+    out.println(_count[i]);
+  }
+
+  uint8_t index = (_logHead + LCD_CHECKER_LOG - _logCount) % LCD_CHECKER_LOG; //the oldest kept
+
+  for (uint8_t i = 0; i < _logCount; i++)
+  {
+    const lcdViolation &violation = _log[index];
+
+    uint8_t rule = 0;
+
+    while ((violation.rule >> rule) > 0x01) {rule++;}
+
+    out.print(F("  #"));
+    out.print(violation.transaction);
+    out.print(F(" byte "));
+    out.print(violation.byte);
+    out.print(F(", "));
+    out.print(lcdRuleName[rule]);
+    out.print(F(" "));
+    out.print(violation.measured);
+    out.print(F("ns < "));
+    out.print(violation.limit);
+    out.print(F("ns"));
+
+    if (violation.site != NULL)
+    {
+      out.print(F(" at "));
+      out.print(violation.site);
+    }
+
+    out.println();
+
+    #if defined (__GLIBC__)
+    char **symbols = backtrace_symbols(violation.caller, violation.frames);
+
+    if (symbols != NULL)
+    {
+      for (uint8_t frame = 0; frame < violation.frames; frame++)
+      {
+        out.print(F("    "));
+        out.println(symbols[frame]);
+      }
+
+      free(symbols);
+    }
+    #endif
+
+    index = (index + 1) % LCD_CHECKER_LOG;
+  }
+}
+
+
+/**************************************************************************/
+/*
+    _now()
+
+    Returns caller time line, in nsec
+
+    NOTE:
+    - "micros()" overflow is handled, time line is 64-bit
+*/
+/**************************************************************************/
+uint64_t LiquidCrystal_I2C_Checker::_now()
+{
+  uint32_t currentMicros = micros();
+
+  _clock     += (uint64_t)(uint32_t)(currentMicros - _lastMicros) * 1000;
+  _lastMicros = currentMicros;
+
+  return _clock;
+}
+
+
+/**************************************************************************/
+/*
+    _portChange()
+
+    Checks PCF8574 ports change at the specified time
+
+    NOTE:
+    - E falling edge latches RS, RW & DB7..DB4, the same as
+      "LiquidCrystal_I2C" padding model
+    - data lines are checked only when RW=0, the controller drives them
+      during read
+    - PCF8574 power-on state is E=1, checks start from the 1-st E rising
+      edge
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::_portChange(uint8_t value, uint64_t time)
+{
+  uint8_t changed = _port ^ value;
+  bool    enRise  = ((changed & _enMask) != 0) && ((value & _enMask) != 0);
+  bool    enFall  = ((changed & _enMask) != 0) && ((value & _enMask) == 0);
+  bool    enHigh  = ((_port & _enMask) != 0) && (enFall == false) && (_pulses == true);
+
+  /* E falling edge, latches old RS, RW & DB7..DB4 */
+  if ((enFall == true) && (_pulses == true))
+  {
+    bool rs = (_port & _rsMask) != 0;
+
+    if (time - _enRise < _profile->enablePulse) {_violation(LCD_CHECK_PULSE_WIDTH, time - _enRise, _profile->enablePulse);}
+
+    if ((_port & _rwMask) == 0)                                        //write
+    {
+      if (time - _dataChange < _profile->dataSetup) {_violation(LCD_CHECK_DATA_SETUP, time - _dataChange, _profile->dataSetup);}
+
+      _latch(rs, (_port & _dataMask) >> _db4Port, time);
+    }
+    else                                                                //read
+    {
+      if ((rs == true) && ((_fourBit == false) || (_readLow == false)) && (time < _busyUntil))
+      {
+        _violation(LCD_CHECK_BUSY, time - _commandStart, _busyUntil - _commandStart);
+      }
+
+      if ((rs == true) && ((_fourBit == false) || (_readLow == true)))
+      {
+        _commandStart = time;                                           //data read moves address counter
+        _busyUntil    = time + (uint64_t)_profile->commandTime * 1000;
+      }
+
+      if (_fourBit == true) {_readLow = !_readLow;}
+    }
+
+    _enFall = time;
+  }
+
+  /* RS & RW */
+  if ((changed & (_rsMask | _rwMask)) != 0)
+  {
+    if      (enHigh == true)                                            {_violation(LCD_CHECK_ADDRESS_HOLD, 0, _profile->addressHold);} //changed during E pulse
+    else if ((_pulses == true) && (time - _enFall < _profile->addressHold)) {_violation(LCD_CHECK_ADDRESS_HOLD, time - _enFall, _profile->addressHold);}
+
+    _addressChange = time;
+  }
+
+  /* DB7..DB4, driven by PCF8574 */
+  if (((changed & _dataMask) != 0) && ((value & _rwMask) == 0))
+  {
+    if ((enHigh == false) && (_pulses == true) && ((_port & _rwMask) == 0) && (time - _enFall < _profile->dataHold))
+    {
+      _violation(LCD_CHECK_DATA_HOLD, time - _enFall, _profile->dataHold);
+    }
+
+    _dataChange = time;
+  }
+
+  /* E rising edge */
+  if (enRise == true)
+  {
+    if ((_pulses == true) && (time - _enRise < _profile->enableCycle)) {_violation(LCD_CHECK_CYCLE, time - _enRise, _profile->enableCycle);}
+
+    if (time - _addressChange < _profile->addressSetup) {_violation(LCD_CHECK_ADDRESS_SETUP, time - _addressChange, _profile->addressSetup);}
+
+    _enRise = time;
+    _pulses = true;
+  }
+
+  _port = value;
+}
+
+
+/**************************************************************************/
+/*
+    _latch()
+
+    Collects written nibbles into instruction or data
+
+    NOTE:
+    - in 8-bit mode DB3..DB0 are not connected & read as low
+    - every written nibble checks busy, busy flag read is always allowed
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::_latch(bool rs, uint8_t nibble, uint64_t time)
+{
+  if (time < _busyUntil) {_violation(LCD_CHECK_BUSY, time - _commandStart, _busyUntil - _commandStart);}
+
+  if (_fourBit == false) {_execute(rs, nibble << 4, time); return;}
+
+  if (_writeLow == false)
+  {
+    _highNibble = nibble;
+    _writeLow   = true;
+
+    return;
+  }
+
+  _writeLow = false;
+
+  _execute(rs, (_highNibble << 4) | nibble, time);
+}
+
+
+/**************************************************************************/
+/*
+    _execute()
+
+    Starts instruction or data write & sets its duration
+
+    NOTE:
+    - the 1-st & the 2-nd 8-bit function set of reset sequence take
+      profile "resetFirstTime" & "resetSecondTime"
+    - any function set switches interface width, the same as controller
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::_execute(bool rs, uint8_t value, uint64_t time)
+{
+  uint32_t duration = _profile->commandTime;
+
+  if (rs == false)
+  {
+    if ((value & 0xE0) == LCD_FUNCTION_SET)
+    {
+      if ((value & LCD_8BIT_MODE) != 0)
+      {
+        if (_fourBit == true) {_resetStep = 0;}
+
+        _fourBit = false;
+        _resetStep++;
+
+        if      (_resetStep == 1) {duration = _profile->resetFirstTime;}
+        else if (_resetStep == 2) {duration = _profile->resetSecondTime;}
+      }
+      else
+      {
+        _fourBit   = true;
+        _resetStep = 0;
+      }
+
+      _writeLow = false;
+      _readLow  = false;
+    }
+    else if ((value & 0xFE) == LCD_RETURN_HOME) {duration = _profile->homeClearTime;}
+    else if (value == LCD_CLEAR_DISPLAY)        {duration = _profile->homeClearTime;}
+  }
+
+  _commandStart = time;
+  _busyUntil    = time + (uint64_t)duration * 1000;
+}
+
+
+/**************************************************************************/
+/*
+    _violation()
+
+    Counts violation & adds it to the log, if rule is checked
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Checker::_violation(uint8_t rule, uint64_t measured, uint32_t limit)
+{
+  if ((_rules & rule) == 0) {return;}
+
+  uint8_t index = 0;
+
+  while ((rule >> index) > 0x01) {index++;}
+
+  _count[index]++;
+
+  lcdViolation &violation = _log[_logHead];
+
+  violation.rule        = rule;
+  violation.transaction = _transactions;
+  violation.byte        = _byte;
+  violation.measured    = (measured > 0xFFFFFFFF) ? 0xFFFFFFFF : measured;
+  violation.limit       = limit;
+  violation.site        = _site;
+
+  #if defined (__GLIBC__)
+  violation.frames = backtrace(violation.caller, LCD_CHECKER_FRAMES);
+  #endif
+
+  _logHead = (_logHead + 1) % LCD_CHECKER_LOG;
+
+  if (_logCount < LCD_CHECKER_LOG) {_logCount++;}
+}
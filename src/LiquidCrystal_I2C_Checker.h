@@ -0,0 +1,145 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - I2C bus backend which checks LCD timing against controller datasheet
+   - every PCF8574 byte is time stamped by bus clock, E pulses, setup &
+     hold times & command durations are checked
+   - works as mock bus on host or passes data to another bus
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Checker_h
+#define LiquidCrystal_I2C_Checker_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_CHECK_PULSE_WIDTH    0x01   //E high time
+#define LCD_CHECK_CYCLE          0x02   //E rising edges distance
+#define LCD_CHECK_ADDRESS_SETUP  0x04   //RS & RW stable before E rising edge
+#define LCD_CHECK_ADDRESS_HOLD   0x08   //RS & RW stable after E falling edge
+#define LCD_CHECK_DATA_SETUP     0x10   //DB7..DB4 stable before E falling edge
+#define LCD_CHECK_DATA_HOLD      0x20   //DB7..DB4 stable after E falling edge
+#define LCD_CHECK_BUSY           0x40   //write before previous command, power-on or reset step is finished
+#define LCD_CHECK_ALL            0x7F
+#define LCD_CHECK_RULES          7
+
+#define LCD_CHECKER_LOG          8      //quantity of the last violations kept for "report()"
+#define LCD_CHECKER_FRAMES       8      //call stack depth of violation, glibc only
+
+#define LCD_CHECKER_STRING2(x)   #x
+#define LCD_CHECKER_STRING(x)    LCD_CHECKER_STRING2(x)
+#define LCD_CHECKER_MARK(checker) (checker).mark(__FILE__ ":" LCD_CHECKER_STRING(__LINE__)) //labels following LCD calls with this file & line
+
+
+typedef struct
+{
+  const char *name;
+  uint16_t    enableCycle;              //E rising edges distance, in nsec
+  uint16_t    enablePulse;              //E high time, in nsec
+  uint16_t    addressSetup;             //RS & RW before E rising edge, in nsec
+  uint16_t    addressHold;              //RS & RW after E falling edge, in nsec
+  uint16_t    dataSetup;                //DB7..DB4 before E falling edge, in nsec
+  uint16_t    dataHold;                 //DB7..DB4 after E falling edge, in nsec
+  uint16_t    commandTime;              //command & character execution, in usec
+  uint16_t    homeClearTime;            //"clear()" & "home()" execution, in usec
+  uint16_t    powerOnTime;              //power-on to the 1-st command, in msec
+  uint16_t    resetFirstTime;           //after the 1-st 8-bit function set, in usec
+  uint16_t    resetSecondTime;          //after the 2-nd 8-bit function set, in usec
+}
+lcdTimingProfile;
+
+typedef struct
+{
+  uint8_t     rule;                     //LCD_CHECK_...
+  uint32_t    transaction;              //I2C write transaction number since "clear()"
+  uint8_t     byte;                     //PCF8574 byte in transaction
+  uint32_t    measured;                 //in nsec
+  uint32_t    limit;                    //in nsec
+  const char *site;                     //label set by "mark()"
+ #if defined (__GLIBC__)
+  void       *caller[LCD_CHECKER_FRAMES];
+  uint8_t     frames;
+ #endif
+}
+lcdViolation;
+
+
+extern const lcdTimingProfile lcdProfileHD44780;
+extern const lcdTimingProfile lcdProfileKS0066;
+extern const lcdTimingProfile lcdProfileST7066U;
+
+
+class LiquidCrystal_I2C_Checker : public LiquidCrystal_I2C_Bus
+{
+  public:
+   LiquidCrystal_I2C_Checker(const lcdTimingProfile &profile = lcdProfileHD44780, LiquidCrystal_I2C_Bus *bus = NULL, uint8_t rsPort = 0, uint8_t rwPort = 1, uint8_t enPort = 2, uint8_t db4Port = 4);
+
+   bool     begin(uint32_t speed);
+   uint8_t  write(uint8_t address, const uint8_t *data, uint8_t length);
+   int16_t  read(uint8_t address);
+
+   void     setRules(uint8_t rules);
+   void     mark(const char *site);
+   uint32_t getViolations(uint8_t rules = LCD_CHECK_ALL);
+   void     clear();
+   void     report(Print &out);
+
+  private:
+   const lcdTimingProfile *_profile;
+   LiquidCrystal_I2C_Bus  *_bus;                                                    //NULL=mock bus, every byte ACKed
+
+   uint8_t      _rsMask;
+   uint8_t      _rwMask;
+   uint8_t      _enMask;
+   uint8_t      _dataMask;
+   uint8_t      _db4Port;
+   uint32_t     _bitTime;                                                           //I2C clock period, in nsec
+   uint8_t      _rules;
+   const char  *_site;
+
+   uint64_t     _clock;                                                             //time line, in nsec
+   uint32_t     _lastMicros;
+   uint64_t     _busFree;                                                           //end of the last transaction, in nsec
+   bool         _powered;
+
+   uint8_t      _port;                                                              //PCF8574 outputs
+   uint64_t     _addressChange;                                                     //last RS & RW change, in nsec
+   uint64_t     _dataChange;                                                        //last DB7..DB4 change, in nsec
+   uint64_t     _enRise;
+   uint64_t     _enFall;
+   bool         _pulses;                                                            //false=no E pulse yet
+
+   uint64_t     _commandStart;
+   uint64_t     _busyUntil;                                                         //end of command, power-on or reset step
+   bool         _fourBit;
+   bool         _writeLow;                                                          //true=the next written nibble is DB3..DB0
+   uint8_t      _highNibble;
+   bool         _readLow;                                                           //true=the next read nibble is DB3..DB0
+   uint8_t      _resetStep;
+
+   uint32_t     _transactions;
+   uint8_t      _byte;
+   uint32_t     _count[LCD_CHECK_RULES];
+   lcdViolation _log[LCD_CHECKER_LOG];
+   uint8_t      _logHead;
+   uint8_t      _logCount;
+
+   uint64_t _now();
+   void     _portChange(uint8_t value, uint64_t time);
+   void     _latch(bool rs, uint8_t nibble, uint64_t time);
+   void     _execute(bool rs, uint8_t value, uint64_t time);
+   void     _violation(uint8_t rule, uint64_t measured, uint32_t limit);
+};
+
+#endif
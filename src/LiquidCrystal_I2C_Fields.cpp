@@ -0,0 +1,233 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - fixed-width numeric & text fields, formatted in stack buffer
+     without "String" & heap
+   - only characters which differ from the previous value are sent
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Fields.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Fields()
+
+    Constructor
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Fields::LiquidCrystal_I2C_Fields(LiquidCrystal_I2C_Base &lcd) : _lcd(lcd)
+{
+  _count = 0;
+}
+
+
+/**************************************************************************/
+/*
+    addField()
+
+    Registers field & returns field id, LCD_FIELD_NONE if all fields
+    are used
+
+    NOTE:
+    - width 1..12 characters, including sign & decimal point
+
+    - "decimals" is quantity of fixed-point digits, value 1234 with
+      2 decimals is printed as "12.34"
+
+    - nothing is sent until the first "updateField()"
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Fields::addField(uint8_t column, uint8_t row, uint8_t width, lcdFieldAlign align, uint8_t decimals)
+{
+  if (_count >= LCD_FIELDS_MAX) {return LCD_FIELD_NONE;}
+
+  lcdField &field = _field[_count];
+
+  field.column   = column;
+  field.row      = row;
+  field.width    = constrain(width, 1, LCD_FIELD_MAX_WIDTH);
+  field.decimals = constrain(decimals, 0, 9);                                //int32_t has 10 digits
+  field.align    = align;
+
+  memset(field.shown, LCD_FIELD_UNKNOWN, LCD_FIELD_MAX_WIDTH);
+
+  return _count++;
+}
+
+
+/**************************************************************************/
+/*
+    updateField()
+
+    Prints integer or fixed-point value in the field
+
+    NOTE:
+    - value is formatted by subtraction of powers of 10, AVR has no
+      hardware division & "Print" divides 32-bit value for every digit
+
+    - field is filled with LCD_FIELD_OVERFLOW if value doesn't fit
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Fields::updateField(uint8_t id, int32_t value)
+{
+  char text[LCD_FIELD_MAX_WIDTH];
+
+  if (id >= _count) {return;}
+
+  _update(_field[id], text, _format(value, _field[id].decimals, text));
+}
+
+
+/**************************************************************************/
+/*
+    updateField()
+
+    Prints text in the field
+
+    NOTE:
+    - text longer than the field is cut
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Fields::updateField(uint8_t id, const char *text)
+{
+  if (id >= _count) {return;}
+
+  uint8_t length = 0;
+
+  while ((length < _field[id].width) && (text[length] != '\0')) {length++;}
+
+  _update(_field[id], text, length);
+}
+
+
+/**************************************************************************/
+/*
+    invalidate()
+
+    Forgets displayed characters, the next "updateField()" sends
+    the whole field
+
+    NOTE:
+    - call after "LiquidCrystal_I2C::clear()" or after text was printed
+      over fields
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Fields::invalidate()
+{
+  for (uint8_t i = 0; i < _count; i++) {memset(_field[i].shown, LCD_FIELD_UNKNOWN, LCD_FIELD_MAX_WIDTH);}
+}
+
+
+/**************************************************************************/
+/*
+    _format()
+
+    Converts value to decimal text & returns text length
+
+    NOTE:
+    - text buffer is LCD_FIELD_MAX_WIDTH, no terminating zero
+
+    - at least one digit before decimal point, -5 with 2 decimals
+      is "-0.05"
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Fields::_format(int32_t value, uint8_t decimals, char *text)
+{
+  static const uint32_t power[10] = {1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL, 1000UL, 100UL, 10UL, 1UL};
+
+  uint32_t number = (value < 0) ? (0UL - (uint32_t)value) : (uint32_t)value; //"-2147483648" has no positive int32_t
+  uint8_t  length = 0;
+  bool     digits = false;                                                   //first non-zero digit found
+
+  if (value < 0) {text[length++] = '-';}
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    char digit = '0';
+
+    while (number >= power[i]) {number -= power[i]; digit++;}               //max 9 subtractions per digit
+
+    if ((digit != '0') || (i >= (9 - decimals))) {digits = true;}           //keep leading zeros of fraction & units digit
+
+    if (digits == false) {continue;}
+
+    if ((decimals != 0) && (i == (10 - decimals))) {text[length++] = '.';}
+
+    text[length++] = digit;
+  }
+
+  return length;
+}
+
+
+/**************************************************************************/
+/*
+    _update()
+
+    Aligns text in the field & sends characters which differ from
+    displayed ones
+
+    NOTE:
+    - changed characters grouped into runs, runs separated by
+      "LCD_FLUSH_MERGE_GAP" or less unchanged characters merged together,
+      same as "LiquidCrystal_I2C::flush()"
+
+    - DDRAM address is skipped if address counter points to the run
+      already, see "LiquidCrystal_I2C::setCursor()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Fields::_update(lcdField &field, const char *text, uint8_t length)
+{
+  uint8_t cells[LCD_FIELD_MAX_WIDTH];
+  uint8_t padding;
+
+  /* align */
+  if (length > field.width)
+  {
+    memset(cells, LCD_FIELD_OVERFLOW, field.width);
+  }
+  else
+  {
+    padding = (field.align == LCD_ALIGN_RIGHT) ? (field.width - length) : 0;
+
+    memset(cells, LCD_SPACE_SYMBOL, field.width);
+    memcpy(&cells[padding], text, length);
+  }
+
+  /* send runs of changed characters */
+  uint8_t column = 0;
+
+  while (column < field.width)
+  {
+    if (cells[column] == field.shown[column]) {column++; continue;}         //skip unchanged character
+
+    uint8_t runStart = column;
+    uint8_t runEnd   = column;
+    uint8_t gap      = 0;
+
+    while ((++column < field.width) && (gap <= LCD_FLUSH_MERGE_GAP))
+    {
+      if (cells[column] != field.shown[column]) {runEnd = column; gap = 0;}
+      else                                      {gap++;}
+    }
+
+    column = runEnd + 1;
+
+    _lcd.setCursor(field.column + runStart, field.row);
+    _lcd.write(&cells[runStart], (runEnd - runStart + 1));
+  }
+
+  memcpy(field.shown, cells, field.width);
+}
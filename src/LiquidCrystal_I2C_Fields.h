@@ -0,0 +1,73 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - fixed-width numeric & text fields, formatted in stack buffer
+     without "String" & heap
+   - only characters which differ from the previous value are sent
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Fields_h
+#define LiquidCrystal_I2C_Fields_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_FIELDS_MAX           8      //maximum number of fields
+#define LCD_FIELD_MAX_WIDTH      12     //"-2147483648" & decimal point
+#define LCD_FIELD_NONE           0xFF   //no free field, see "addField()"
+#define LCD_FIELD_OVERFLOW       '#'    //fills field if value doesn't fit
+#define LCD_FIELD_UNKNOWN        0x00   //displayed character is unknown, never produced by formatting
+
+
+typedef enum : uint8_t
+{
+  LCD_ALIGN_LEFT  = 0x00,
+  LCD_ALIGN_RIGHT = 0x01
+}
+lcdFieldAlign;
+
+
+typedef struct
+{
+  uint8_t       column;
+  uint8_t       row;
+  uint8_t       width;
+  uint8_t       decimals;                                                           //fixed-point digits after decimal point
+  lcdFieldAlign align;
+  uint8_t       shown[LCD_FIELD_MAX_WIDTH];                                         //characters on the screen
+}
+lcdField;
+
+
+class LiquidCrystal_I2C_Fields
+{
+  public:
+   LiquidCrystal_I2C_Fields(LiquidCrystal_I2C_Base &lcd);
+
+   uint8_t addField(uint8_t column, uint8_t row, uint8_t width, lcdFieldAlign align = LCD_ALIGN_RIGHT, uint8_t decimals = 0);
+   void    updateField(uint8_t id, int32_t value);
+   void    updateField(uint8_t id, const char *text);
+   void    invalidate();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   lcdField _field[LCD_FIELDS_MAX];
+   uint8_t  _count;
+
+   uint8_t _format(int32_t value, uint8_t decimals, char *text);
+   void    _update(lcdField &field, const char *text, uint8_t length);
+};
+
+#endif
@@ -0,0 +1,197 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - CGRAM glyph cache, loads custom characters on demand into free CGRAM slots
+   - only 5x8 dots custom characters are supported
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_GlyphCache.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_GlyphCache()
+
+    Constructor. Defines LCD & range of CGRAM slots managed by cache
+
+    NOTE:
+    - slots outside "firstSlot..firstSlot + slots - 1" are never touched,
+      keep them for "createChar()"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_GlyphCache::LiquidCrystal_I2C_GlyphCache(LiquidCrystal_I2C_Base &lcd, uint8_t firstSlot, uint8_t slots) : _lcd(lcd)
+{
+  _firstSlot = constrain(firstSlot, 0, (LCD_CGRAM_SLOTS - 1));
+  _slots     = constrain(slots, 1, (LCD_CGRAM_SLOTS - _firstSlot));
+
+  invalidate();
+}
+
+
+/**************************************************************************/
+/*
+    load()
+
+    Returns custom character code of glyph from MCU dynamic memory,
+    uploads glyph to CGRAM if it isn't there yet
+
+    NOTE:
+    - glyph is array of 8 rows, see "createChar()"
+
+    - nothing is sent to LCD if the same glyph is already in CGRAM
+
+    - if all slots are in use, least recently used glyph which is not
+      on the screen is replaced, screen contents is known only with
+      framebuffer, see "enableFramebuffer()"
+
+    - without framebuffer loaded glyph is replaced only after "release()",
+      replacing CGRAM of a glyph on the screen changes it on the screen
+
+    - returns LCD_GLYPH_NOT_LOADED if all glyphs are on the screen
+*/
+/**************************************************************************/
+int8_t LiquidCrystal_I2C_GlyphCache::load(uint8_t *glyph)
+{
+  return _load(glyph, false);
+}
+
+
+/**************************************************************************/
+/*
+    load()
+
+    Returns custom character code of glyph from MCU flash memory,
+    uploads glyph to CGRAM if it isn't there yet
+
+    NOTE:
+    - see "load(uint8_t *glyph)" for details
+*/
+/**************************************************************************/
+#if defined (PROGMEM)
+int8_t LiquidCrystal_I2C_GlyphCache::load(const uint8_t *glyph)
+{
+  return _load(glyph, true);
+}
+#endif
+
+
+/**************************************************************************/
+/*
+    release()
+
+    Marks glyph as removed from the screen, its CGRAM slot can be
+    replaced by the next "load()"
+
+    NOTE:
+    - "character" is code returned by "load()"
+
+    - needed without framebuffer only, framebuffer shows which glyphs
+      are on the screen, see "isCharacterVisible()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_GlyphCache::release(uint8_t character)
+{
+  if ((character < _firstSlot) || (character >= (_firstSlot + _slots))) {return;} //safety check, slot isn't managed by cache
+
+  _released |= (1 << (character - _firstSlot));
+}
+
+
+/**************************************************************************/
+/*
+    invalidate()
+
+    Forgets all loaded glyphs
+
+    NOTE:
+    - call after "begin()" or "createChar()" in cache slots
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_GlyphCache::invalidate()
+{
+  memset(_lastUse, 0, sizeof(_lastUse));
+
+  _useCounter = 0;
+  _released   = 0;
+}
+
+
+/**************************************************************************/
+/*
+    _load()
+
+    Finds glyph in cache or uploads it to the best free slot
+
+    NOTE:
+    - slot priority: same glyph, empty slot, least recently used slot
+      which is not on the screen or released, see "release()"
+*/
+/**************************************************************************/
+int8_t LiquidCrystal_I2C_GlyphCache::_load(const uint8_t *glyph, bool flash)
+{
+  uint8_t row[LCD_GLYPH_ROWS];
+  int8_t  slot = LCD_GLYPH_NOT_LOADED;
+
+  for (uint8_t i = 0; i < LCD_GLYPH_ROWS; i++)
+  {
+    #if defined (PROGMEM)
+    row[i] = (flash == true) ? pgm_read_byte(&glyph[i]) : glyph[i];
+    #else
+    row[i] = glyph[i];
+    #endif
+  }
+
+  /* LRU time stamp overflow, restart stamps & keep the order */
+  if (_useCounter == 0xFFFF)
+  {
+    for (uint8_t i = 0; i < _slots; i++) {_lastUse[i] = (_lastUse[i] != 0) ? (_lastUse[i] >> 8) + 1 : 0;}
+
+    _useCounter = 0x0100;
+  }
+
+  _useCounter++;
+
+  /* glyph already loaded */
+  for (uint8_t i = 0; i < _slots; i++)
+  {
+    if ((_lastUse[i] != 0) && (memcmp(_glyph[i], row, LCD_GLYPH_ROWS) == 0))
+    {
+      _lastUse[i]  = _useCounter;
+      _released   &= ~(1 << i);                                                   //glyph goes back to the screen
+
+      return _firstSlot + i;
+    }
+  }
+
+  /* empty slot or least recently used slot which is not on the screen */
+  for (uint8_t i = 0; i < _slots; i++)
+  {
+    if (_lastUse[i] == 0) {slot = i; break;}
+
+    if (((_released & (1 << i)) == 0) && (_lcd.isCharacterVisible(_firstSlot + i) == true)) {continue;} //always visible without framebuffer
+
+    if ((slot == LCD_GLYPH_NOT_LOADED) || (_lastUse[i] < _lastUse[slot])) {slot = i;}
+  }
+
+  if (slot == LCD_GLYPH_NOT_LOADED) {return LCD_GLYPH_NOT_LOADED;}
+
+  memcpy(_glyph[slot], row, LCD_GLYPH_ROWS);
+
+  _lastUse[slot]  = _useCounter;
+  _released      &= ~(1 << slot);
+
+  _lcd.createChar(_firstSlot + slot, row, LCD_GLYPH_ROWS);
+
+  return _firstSlot + slot;
+}
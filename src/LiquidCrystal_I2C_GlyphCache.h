@@ -0,0 +1,55 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - CGRAM glyph cache, loads custom characters on demand into free CGRAM slots
+   - only 5x8 dots custom characters are supported
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_GlyphCache_h
+#define LiquidCrystal_I2C_GlyphCache_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_CGRAM_SLOTS          8      //quantity of 5x8 dots custom characters in CGRAM
+#define LCD_GLYPH_ROWS           8      //5x8 dots custom character size, in rows
+#define LCD_GLYPH_NOT_LOADED     -1     //returned if all CGRAM slots are in use
+
+
+class LiquidCrystal_I2C_GlyphCache
+{
+  public:
+   LiquidCrystal_I2C_GlyphCache(LiquidCrystal_I2C_Base &lcd, uint8_t firstSlot = 0, uint8_t slots = LCD_CGRAM_SLOTS);
+
+   int8_t load(uint8_t *glyph);
+  #if defined (PROGMEM)
+   int8_t load(const uint8_t *glyph);
+  #endif
+   void   release(uint8_t character);
+   void   invalidate();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   uint8_t  _firstSlot;
+   uint8_t  _slots;
+   uint8_t  _glyph[LCD_CGRAM_SLOTS][LCD_GLYPH_ROWS]; //copy of loaded custom characters
+   uint16_t _lastUse[LCD_CGRAM_SLOTS];               //0=empty slot, LRU time stamp
+   uint16_t _useCounter = 0;
+   uint8_t  _released;                               //bit per slot, glyph was removed from the screen, see "release()"
+
+   int8_t _load(const uint8_t *glyph, bool flash);
+};
+
+#endif
@@ -0,0 +1,236 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - Linux "/dev/i2c-N" bus backend for single board computers with Arduino API
+     layer, whole I2C transaction is sent by one "I2C_RDWR" ioctl() call
+   - adapters without plain I2C support (SMBus only, "i2c-stub") are driven
+     with one SMBus "send byte" per byte
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_LinuxI2C.h"
+
+#if defined (__linux__)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_LinuxI2C()
+
+    Constructor. Defines I2C adapter device, opened by "begin()"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_LinuxI2C::LiquidCrystal_I2C_LinuxI2C(const char *device)
+{
+  _device   = device;
+  _fd       = -1;
+  _ownFd    = true;
+  _plainI2C = true;
+}
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_LinuxI2C()
+
+    Constructor. Uses I2C adapter descriptor opened by the caller
+
+    NOTE:
+    - descriptor is never closed by this class
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_LinuxI2C::LiquidCrystal_I2C_LinuxI2C(int fd)
+{
+  _device   = NULL;
+  _fd       = fd;
+  _ownFd    = false;
+  _plainI2C = true;
+}
+
+
+/**************************************************************************/
+/*
+    ~LiquidCrystal_I2C_LinuxI2C()
+
+    Destructor. Closes I2C adapter device
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_LinuxI2C::~LiquidCrystal_I2C_LinuxI2C()
+{
+  if ((_ownFd == true) && (_fd >= 0)) {close(_fd);}
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Opens I2C adapter device & checks adapter functionality
+
+    NOTE:
+    - bus speed is set by device tree or kernel module parameter, use
+      the same speed in "LiquidCrystal_I2C::begin()"
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_LinuxI2C::begin(uint32_t speed)
+{
+  unsigned long funcs = 0;
+
+  (void)speed;
+
+  if ((_ownFd == true) && (_fd < 0)) {_fd = open(_device, O_RDWR);}
+
+  if (_fd < 0) {return false;}
+
+  if (ioctl(_fd, I2C_FUNCS, &funcs) < 0) {return false;}
+
+  _plainI2C = ((funcs & I2C_FUNC_I2C) != 0);
+
+  if ((_plainI2C == false) && ((funcs & I2C_FUNC_SMBUS_BYTE) != I2C_FUNC_SMBUS_BYTE)) {return false;} //adapter can't talk to PCF8574
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Writes data to slave in one I2C transaction
+
+    NOTE:
+    - one ioctl() call per transaction, instead of one write() per byte
+
+    - zero length write is presence check, sent as 1-byte read
+
+    - returns "Wire.endTransmission()" compatible values:
+      - 0, success
+      - 2, received NACK or adapter error
+      - 4, bus isn't opened
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_LinuxI2C::write(uint8_t address, const uint8_t *data, uint8_t length)
+{
+  if (_fd < 0) {return 4;}
+
+  if (_plainI2C == true)
+  {
+    struct i2c_msg             message;
+    struct i2c_rdwr_ioctl_data transfer;
+    uint8_t                    value;
+
+    message.addr  = address;
+    message.flags = 0;
+    message.len   = length;
+    message.buf   = (uint8_t *)data;    //kernel doesn't change write buffer
+
+    if (length == 0)                    //1-byte read as presence check, zero length message is rejected by "I2C_AQ_NO_ZERO_LEN" adapters
+    {
+      message.flags = I2C_M_RD;
+      message.len   = 1;
+      message.buf   = &value;
+    }
+
+    transfer.msgs  = &message;
+    transfer.nmsgs = 1;
+
+    return (ioctl(_fd, I2C_RDWR, &transfer) < 0) ? 2 : 0;
+  }
+
+  /* SMBus only adapter */
+  if (length == 0) {return (_smbusAccess(address, I2C_SMBUS_READ, NULL) == true) ? 0 : 2;} //"read byte" as presence check, "quick" isn't supported by all adapters
+
+  for (uint8_t i = 0; i < length; i++)
+  {
+    uint8_t value = data[i];
+
+    if (_smbusAccess(address, I2C_SMBUS_WRITE, &value) == false) {return 2;}
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************/
+/*
+    read()
+
+    Reads 1-byte from slave
+
+    NOTE:
+    - returns -1 if slave doesn't respond
+*/
+/**************************************************************************/
+int16_t LiquidCrystal_I2C_LinuxI2C::read(uint8_t address)
+{
+  uint8_t value = 0;
+
+  if (_fd < 0) {return -1;}
+
+  if (_plainI2C == true)
+  {
+    struct i2c_msg             message;
+    struct i2c_rdwr_ioctl_data transfer;
+
+    message.addr  = address;
+    message.flags = I2C_M_RD;
+    message.len   = 1;
+    message.buf   = &value;
+
+    transfer.msgs  = &message;
+    transfer.nmsgs = 1;
+
+    return (ioctl(_fd, I2C_RDWR, &transfer) < 0) ? -1 : value;
+  }
+
+  return (_smbusAccess(address, I2C_SMBUS_READ, &value) == true) ? value : -1;
+}
+
+
+/**************************************************************************/
+/*
+    _smbusAccess()
+
+    SMBus "send byte" & "receive byte", the PCF8574 native transactions
+
+    NOTE:
+    - "send byte" value is carried in "command" field, see kernel
+      Documentation/i2c/smbus-protocol
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_LinuxI2C::_smbusAccess(uint8_t address, uint8_t readWrite, uint8_t *value)
+{
+  union i2c_smbus_data           data;
+  struct i2c_smbus_ioctl_data    access;
+
+  if (ioctl(_fd, I2C_SLAVE, address) < 0) {return false;}
+
+  access.read_write = readWrite;
+  access.command    = ((readWrite == I2C_SMBUS_WRITE) && (value != NULL)) ? *value : 0;
+  access.size       = I2C_SMBUS_BYTE;
+  access.data       = (readWrite == I2C_SMBUS_READ) ? &data : NULL;
+
+  if (ioctl(_fd, I2C_SMBUS, &access) < 0) {return false;}
+
+  if ((readWrite == I2C_SMBUS_READ) && (value != NULL)) {*value = data.byte;}
+
+  return true;
+}
+
+#endif
@@ -0,0 +1,51 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - Linux "/dev/i2c-N" bus backend for single board computers with Arduino API
+     layer, whole I2C transaction is sent by one "I2C_RDWR" ioctl() call
+   - adapters without plain I2C support (SMBus only, "i2c-stub") are driven
+     with one SMBus "send byte" per byte
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_LinuxI2C_h
+#define LiquidCrystal_I2C_LinuxI2C_h
+
+#include "LiquidCrystal_I2C.h"
+
+#if defined (__linux__)
+
+
+class LiquidCrystal_I2C_LinuxI2C : public LiquidCrystal_I2C_Bus
+{
+  public:
+   LiquidCrystal_I2C_LinuxI2C(const char *device = "/dev/i2c-1");
+   LiquidCrystal_I2C_LinuxI2C(int fd);
+  ~LiquidCrystal_I2C_LinuxI2C();
+
+   bool    begin(uint32_t speed);
+   uint8_t write(uint8_t address, const uint8_t *data, uint8_t length);
+   int16_t read(uint8_t address);
+
+  private:
+   const char *_device;
+   int         _fd;
+   bool        _ownFd;                  //true=descriptor opened by "begin()" & closed by destructor
+   bool        _plainI2C;               //true=adapter supports I2C_RDWR, false=SMBus only
+
+   bool    _smbusAccess(uint8_t address, uint8_t readWrite, uint8_t *value);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,323 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - lock-free ring of text & commands in front of the display, tasks
+     & interrupts only copy data into the ring & never wait for I2C
+   - one owner task sends the ring to LCD, the only context which
+     calls "LiquidCrystal_I2C" functions
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Mailbox.h"
+
+
+/*
+   atomic access to ring positions & record length
+   - AVR has no atomic 16-bit load & no compare-and-swap, interrupts
+     are disabled for a few cycles instead, ISR is the only preemption
+   - other architectures use GCC "__atomic" builtins, acquire & release
+     order makes record bytes visible before its length
+*/
+#if defined (ARDUINO_ARCH_AVR)
+#include <util/atomic.h>
+
+static inline uint16_t lcdAtomicLoad(volatile uint16_t *value)
+{
+  uint16_t result;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {result = *value;}
+
+  return result;
+}
+
+static inline void lcdAtomicStore(volatile uint16_t *value, uint16_t data)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {*value = data;}
+}
+
+static inline bool lcdAtomicCompareExchange(volatile uint16_t *value, uint16_t expected, uint16_t data)
+{
+  bool result = false;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {if (*value == expected) {*value = data; result = true;}}
+
+  return result;
+}
+
+static inline void lcdAtomicIncrement(volatile uint16_t *value)
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {(*value)++;}
+}
+
+static inline uint8_t lcdAtomicLoadByte(uint8_t *value)
+{
+  uint8_t result = *(volatile uint8_t *)value;                                 //8-bit access is atomic
+
+  __asm__ __volatile__ ("" ::: "memory");                                      //record bytes are read after length
+
+  return result;
+}
+
+static inline void lcdAtomicStoreByte(uint8_t *value, uint8_t data)
+{
+  __asm__ __volatile__ ("" ::: "memory");                                      //record bytes are written before length
+
+  *(volatile uint8_t *)value = data;
+}
+#else
+static inline uint16_t lcdAtomicLoad(volatile uint16_t *value)
+{
+  return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static inline void lcdAtomicStore(volatile uint16_t *value, uint16_t data)
+{
+  __atomic_store_n(value, data, __ATOMIC_RELEASE);
+}
+
+static inline bool lcdAtomicCompareExchange(volatile uint16_t *value, uint16_t expected, uint16_t data)
+{
+  return __atomic_compare_exchange_n(value, &expected, data, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static inline void lcdAtomicIncrement(volatile uint16_t *value)
+{
+  __atomic_fetch_add(value, 1, __ATOMIC_RELAXED);
+}
+
+static inline uint8_t lcdAtomicLoadByte(uint8_t *value)
+{
+  return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static inline void lcdAtomicStoreByte(uint8_t *value, uint8_t data)
+{
+  __atomic_store_n(value, data, __ATOMIC_RELEASE);
+}
+#endif
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Mailbox()
+
+    Constructor. Defines ring buffer & quantity of producers
+
+    NOTE:
+    - buffer size is power of 2, 64..32768 bytes, other sizes are
+      rounded down, e.g.
+        uint8_t lcdMailbox[256];
+        LiquidCrystal_I2C_Mailbox mailbox(lcd, lcdMailbox, sizeof(lcdMailbox));
+
+    - every text record takes 3 bytes & text length
+
+    - LCD_MAILBOX_SINGLE_PRODUCER is faster, only one task or interrupt
+      may call "post()", LCD_MAILBOX_MULTI_PRODUCER reserves space with
+      compare-and-swap, producers never wait for each other
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Mailbox::LiquidCrystal_I2C_Mailbox(LiquidCrystal_I2C_Base &lcd, uint8_t *buffer, uint16_t size, lcdMailboxMode mode) : _lcd(lcd)
+{
+  uint16_t ringSize = 0x8000;
+
+  while ((ringSize > size) && (ringSize > 1)) {ringSize >>= 1;}              //round down to power of 2
+
+  _buffer  = buffer;
+  _mask    = ringSize - 1;
+  _mode    = mode;
+  _reserve = 0;
+  _tail    = 0;
+  _dropped = 0;
+
+  if (_buffer != NULL) {memset(_buffer, 0, ringSize);}                       //0=record isn't written yet, see "drain()"
+}
+
+
+/**************************************************************************/
+/*
+    post()
+
+    Copies text & position into the ring, returns false if ring is full
+
+    NOTE:
+    - safe from any task or interrupt, see constructor
+    - text longer than 40 characters is cut
+    - never blocks, record is dropped if ring is full, see "getDropped()"
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Mailbox::post(uint8_t column, uint8_t row, const char *text)
+{
+  uint8_t size = 0;
+
+  while ((size < LCD_MAX_COLUMNS) && (text[size] != '\0')) {size++;}
+
+  return _post(column, row, (const uint8_t *)text, size);
+}
+
+
+/**************************************************************************/
+/*
+    post()
+
+    Copies characters & position into the ring, returns false if ring
+    is full
+
+    NOTE:
+    - see "post(uint8_t column, uint8_t row, const char *text)"
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Mailbox::post(uint8_t column, uint8_t row, const uint8_t *data, uint8_t size)
+{
+  if (size > LCD_MAX_COLUMNS) {size = LCD_MAX_COLUMNS;}
+
+  return _post(column, row, data, size);
+}
+
+
+/**************************************************************************/
+/*
+    postCommand()
+
+    Copies command into the ring, returns false if ring is full
+
+    NOTE:
+    - commands & text are sent in the same order as they were posted
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Mailbox::postCommand(lcdPostCommand command)
+{
+  return _post(LCD_MAILBOX_COMMAND, command, NULL, 0);
+}
+
+
+/**************************************************************************/
+/*
+    drain()
+
+    Sends posted records to LCD, returns quantity of sent records
+
+    NOTE:
+    - call from one owner task or "loop()" only, the only place which
+      uses LCD & I2C bus
+
+    - stops at the first record which is reserved but still being
+      copied by producer, it is sent by the next "drain()"
+
+    - sent bytes are zeroed before ring position is moved, so the next
+      producer writes into clean space
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Mailbox::drain(uint8_t maxRecords)
+{
+  uint8_t  record[LCD_MAILBOX_MAX_RECORD];
+  uint8_t  count = 0;
+  uint16_t tail  = _tail;                                                     //consumer owns tail
+
+  while (count < maxRecords)
+  {
+    if (tail == lcdAtomicLoad(&_reserve)) {break;}                            //ring is empty
+
+    uint8_t length = lcdAtomicLoadByte(&_buffer[tail & _mask]);
+
+    if (length == 0) {break;}                                                 //record is still copied
+
+    for (uint8_t i = 0; i < length; i++)
+    {
+      record[i] = _buffer[(tail + i) & _mask];
+
+      _buffer[(tail + i) & _mask] = 0;
+    }
+
+    tail += length;
+
+    lcdAtomicStore(&_tail, tail);                                             //free space for producers
+
+    if (record[1] == LCD_MAILBOX_COMMAND)
+    {
+      switch (record[2])
+      {
+        case LCD_POST_CLEAR:        _lcd.clear();       break;
+        case LCD_POST_HOME:         _lcd.home();        break;
+        case LCD_POST_DISPLAY:      _lcd.display();     break;
+        case LCD_POST_NO_DISPLAY:   _lcd.noDisplay();   break;
+        case LCD_POST_BACKLIGHT:    _lcd.backlight();   break;
+        case LCD_POST_NO_BACKLIGHT: _lcd.noBacklight(); break;
+      }
+    }
+    else
+    {
+      _lcd.setCursor(record[1], record[2]);
+      _lcd.write(&record[LCD_MAILBOX_HEADER], length - LCD_MAILBOX_HEADER);
+    }
+
+    count++;
+  }
+
+  return count;
+}
+
+
+/**************************************************************************/
+/*
+    getDropped()
+
+    Returns quantity of records which didn't fit into the ring
+*/
+/**************************************************************************/
+uint16_t LiquidCrystal_I2C_Mailbox::getDropped()
+{
+  return lcdAtomicLoad(&_dropped);
+}
+
+
+/**************************************************************************/
+/*
+    _post()
+
+    Reserves space, copies record & publishes record length
+
+    NOTE:
+    - record: length, column, row, characters
+    - length is written last, "drain()" doesn't read record until length
+      isn't 0
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Mailbox::_post(uint8_t column, uint8_t row, const uint8_t *data, uint8_t size)
+{
+  if (_buffer == NULL) {return false;}
+
+  uint8_t  length = LCD_MAILBOX_HEADER + size;
+  uint16_t start;
+
+  /* reserve space */
+  while (true)
+  {
+    start = lcdAtomicLoad(&_reserve);
+
+    if ((uint16_t)(_mask + 1 - (uint16_t)(start - lcdAtomicLoad(&_tail))) < length) {lcdAtomicIncrement(&_dropped); return false;} //ring is full
+
+    if (_mode == LCD_MAILBOX_SINGLE_PRODUCER) {lcdAtomicStore(&_reserve, start + length); break;}
+
+    if (lcdAtomicCompareExchange(&_reserve, start, start + length) == true) {break;} //another producer was faster, try again
+  }
+
+  /* copy record */
+  _buffer[(start + 1) & _mask] = column;
+  _buffer[(start + 2) & _mask] = row;
+
+  for (uint8_t i = 0; i < size; i++) {_buffer[(start + LCD_MAILBOX_HEADER + i) & _mask] = data[i];}
+
+  lcdAtomicStoreByte(&_buffer[start & _mask], length);                       //publish record
+
+  return true;
+}
@@ -0,0 +1,76 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - lock-free ring of text & commands in front of the display, tasks
+     & interrupts only copy data into the ring & never wait for I2C
+   - one owner task sends the ring to LCD, the only context which
+     calls "LiquidCrystal_I2C" functions
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Mailbox_h
+#define LiquidCrystal_I2C_Mailbox_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_MAILBOX_HEADER       3                                             //record length, column & row
+#define LCD_MAILBOX_MAX_RECORD   (LCD_MAILBOX_HEADER + LCD_MAX_COLUMNS)        //the longest record, in bytes
+#define LCD_MAILBOX_COMMAND      0xFF                                          //record column of "postCommand()"
+
+
+typedef enum : uint8_t
+{
+  LCD_MAILBOX_SINGLE_PRODUCER = 0x00,                                          //one task or interrupt calls "post()"
+  LCD_MAILBOX_MULTI_PRODUCER  = 0x01                                           //many tasks & interrupts call "post()"
+}
+lcdMailboxMode;
+
+typedef enum : uint8_t
+{
+  LCD_POST_CLEAR        = 0x00,
+  LCD_POST_HOME         = 0x01,
+  LCD_POST_DISPLAY      = 0x02,
+  LCD_POST_NO_DISPLAY   = 0x03,
+  LCD_POST_BACKLIGHT    = 0x04,
+  LCD_POST_NO_BACKLIGHT = 0x05
+}
+lcdPostCommand;
+
+
+class LiquidCrystal_I2C_Mailbox
+{
+  public:
+   LiquidCrystal_I2C_Mailbox(LiquidCrystal_I2C_Base &lcd, uint8_t *buffer, uint16_t size, lcdMailboxMode mode = LCD_MAILBOX_SINGLE_PRODUCER);
+
+   bool     post(uint8_t column, uint8_t row, const char *text);
+   bool     post(uint8_t column, uint8_t row, const uint8_t *data, uint8_t size);
+   bool     postCommand(lcdPostCommand command);
+   uint8_t  drain(uint8_t maxRecords = 0xFF);
+   uint16_t getDropped();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   uint8_t          *_buffer;                                                 //records, free bytes must be 0
+   uint16_t          _mask;                                                   //buffer size - 1, size is power of 2
+   lcdMailboxMode    _mode;
+
+   volatile uint16_t _reserve;                                                //producers write position, free-running
+   volatile uint16_t _tail;                                                   //consumer read position, free-running
+   volatile uint16_t _dropped;                                                //records which didn't fit
+
+   bool _post(uint8_t column, uint8_t row, const uint8_t *data, uint8_t size);
+};
+
+#endif
@@ -0,0 +1,278 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - scrolling text lines longer than the screen, moved by one-byte
+     hardware display shift instead of reprinting the whole row
+   - display shift moves both DDRAM lines, for 1 & 2 rows displays only
+   - 1 row display runs in 1-line mode, one 80-characters DDRAM line
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Marquee.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Marquee()
+
+    Constructor. Defines screen width & scroll step
+
+    NOTE:
+    - "columns" is visible width of the screen, the rest of 40-characters
+      DDRAM line is used to preload text, 80-characters line in 1-line
+      mode
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Marquee::LiquidCrystal_I2C_Marquee(LiquidCrystal_I2C_Base &lcd, uint8_t columns, uint16_t interval) : _lcd(lcd)
+{
+  _columns  = constrain(columns, 1, LCD_MARQUEE_LINE_SIZE);
+  _interval = interval;
+  _lastStep = 0;
+  _shift    = 0;
+  _lineSize = LCD_MARQUEE_LINE_SIZE;
+  _rows     = LCD_MARQUEE_ROWS;
+
+  for (uint8_t row = 0; row < LCD_MARQUEE_ROWS; row++)
+  {
+    _text[row]     = NULL;
+    _length[row]   = 0;
+    _period[row]   = LCD_MARQUEE_LINE_SIZE;
+    _position[row] = 0;
+    _loaded[row]   = 0;
+  }
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Returns display to home position & loads both DDRAM lines
+
+    NOTE:
+    - call after "LiquidCrystal_I2C::begin()" & "setText()"
+
+    - 1 row display has one 80-characters DDRAM line, see "_lineMode()"
+
+    - framebuffer must be disabled, marquee writes DDRAM directly, see
+      "LiquidCrystal_I2C::writeDDRAM()"
+
+    - "home()" duration > 1.53msec
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::begin()
+{
+  _lcd.home();
+
+  _lineMode();
+
+  _shift    = 0;
+  _lastStep = millis();
+
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    _setPeriod(row);
+
+    _position[row] = 0;
+
+    _load(row, 0);
+  }
+}
+
+
+/**************************************************************************/
+/*
+    setText()
+
+    Sets text of the row & loads it into DDRAM line, text starts at the
+    1-st column
+
+    NOTE:
+    - row 0..1, DDRAM line of the row is reloaded every time, up to 40
+      characters
+
+    - row 0 only on 1 row display, DDRAM line is 80 characters long,
+      text up to 76 characters is moved by display shift only
+
+    - text isn't copied, it must stay in memory while it scrolls
+
+    - text up to 36 characters is loaded once & moved by display shift
+      only, longer text is followed by 4 spaces & loaded in pieces into
+      characters outside of the screen, see "step()"
+
+    - NULL clears the row
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::setText(uint8_t row, const char *text)
+{
+  _lineMode();
+
+  if (row >= _rows) {return;}                                                             //safety check, display shift moves DDRAM lines
+
+  _text[row]     = text;
+  _length[row]   = (text != NULL) ? strlen(text) : 0;
+  _position[row] = 0;
+
+  _setPeriod(row);
+
+  _load(row, 0);
+}
+
+
+/**************************************************************************/
+/*
+    setInterval()
+
+    Sets time between scroll steps, in msec
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::setInterval(uint16_t interval)
+{
+  _interval = interval;
+}
+
+
+/**************************************************************************/
+/*
+    tick()
+
+    Scrolls text by one character if scroll step is elapsed, returns
+    true if text was scrolled
+
+    NOTE:
+    - doesn't block, call from "loop()" as often as possible
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Marquee::tick()
+{
+  if ((millis() - _lastStep) < _interval) {return false;}
+
+  _lastStep = millis();
+
+  step();
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    step()
+
+    Scrolls text of both rows to the left by one character
+
+    NOTE:
+    - text fitting into DDRAM line costs one shift command per step
+
+    - longer text reloads all characters outside of the screen once per
+      "line size - columns" steps, on average ~1 extra byte per step instead of
+      reprinting all columns of the row
+
+    - 40 columns display has no characters outside of the screen, the
+      last column is written right after shift
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::step()
+{
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    if ((_period[row] != _lineSize) && (_loaded[row] <= _columns)) {_load(row, _loaded[row]);} //next character comes from outside of the screen
+  }
+
+  _lcd.scrollDisplayLeft();
+
+  _shift = (_shift + 1) % _lineSize;
+
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    _position[row] = (_position[row] + 1) % _period[row];
+
+    if (_period[row] == _lineSize) {continue;}                                            //text & DDRAM line have the same period, nothing to reload
+
+    _loaded[row]--;
+
+    if (_loaded[row] < _columns) {_load(row, _loaded[row]);}                              //40 columns display, see NOTE
+  }
+}
+
+
+/**************************************************************************/
+/*
+    _lineMode()
+
+    Sets DDRAM line size & quantity of lines from rows of the display
+
+    NOTE:
+    - 1 row display runs in 1-line mode, DDRAM 0x00..0x4F is one line &
+      display shift wraps it at 80 characters
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::_lineMode()
+{
+  bool oneLine = (_lcd.getRows() == 1);
+
+  _lineSize = (oneLine == true) ? LCD_MARQUEE_1_LINE_SIZE : LCD_MARQUEE_LINE_SIZE;
+  _rows     = (oneLine == true) ? 1                       : LCD_MARQUEE_ROWS;
+}
+
+
+/**************************************************************************/
+/*
+    _setPeriod()
+
+    Sets text & gap length of the row, DDRAM line size if text & gap fit
+    into DDRAM line
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::_setPeriod(uint8_t row)
+{
+  _period[row] = ((_length[row] + LCD_MARQUEE_GAP) <= _lineSize) ? _lineSize : (_length[row] + LCD_MARQUEE_GAP);
+}
+
+
+/**************************************************************************/
+/*
+    _load()
+
+    Writes text of the row to DDRAM characters "from..line size - 1",
+    counted from the 1-st column
+
+    NOTE:
+    - DDRAM line wraps from 39 to 0 under display shift, but DDRAM
+      address increments to the next line, so text is sent in 2 parts,
+      from 79 to 0 in 1-line mode
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Marquee::_load(uint8_t row, uint8_t from)
+{
+  uint8_t  buffer[LCD_MARQUEE_1_LINE_SIZE];
+  uint8_t  length = 0;
+  uint8_t  start  = (_shift + from) % _lineSize;                                          //DDRAM position of the 1-st character
+  uint16_t index;
+
+  for (uint8_t i = from; i < _lineSize; i++)
+  {
+    index = ((uint32_t)_position[row] + i) % _period[row];
+
+    buffer[length++] = (index < _length[row]) ? _text[row][index] : LCD_SPACE_SYMBOL;
+  }
+
+  uint8_t first = _lineSize - start;                                          //characters before DDRAM line wraps
+
+  if (first > length) {first = length;}
+
+  if (first  > 0)      {_lcd.writeDDRAM((row * 0x40) + start, buffer, first);}
+  if (length > first)  {_lcd.writeDDRAM((row * 0x40), &buffer[first], length - first);}
+
+  _loaded[row] = _lineSize;
+}
@@ -0,0 +1,66 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - scrolling text lines longer than the screen, moved by one-byte
+     hardware display shift instead of reprinting the whole row
+   - display shift moves both DDRAM lines, for 1 & 2 rows displays only
+   - 1 row display runs in 1-line mode, one 80-characters DDRAM line
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Marquee_h
+#define LiquidCrystal_I2C_Marquee_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_MARQUEE_ROWS        2     //DDRAM lines, both are moved by the same shift command
+#define LCD_MARQUEE_LINE_SIZE   40    //2-line mode DDRAM line length, in characters
+#define LCD_MARQUEE_1_LINE_SIZE 80    //1-line mode DDRAM line length, in characters
+#define LCD_MARQUEE_GAP         4     //spaces between the end & the start of text longer than DDRAM line
+#define LCD_MARQUEE_INTERVAL    300   //default scroll step, in msec
+
+
+class LiquidCrystal_I2C_Marquee
+{
+  public:
+   LiquidCrystal_I2C_Marquee(LiquidCrystal_I2C_Base &lcd, uint8_t columns = LCD_COLUMNS_SIZE, uint16_t interval = LCD_MARQUEE_INTERVAL);
+
+   void begin();
+   void setText(uint8_t row, const char *text);
+   void setInterval(uint16_t interval);
+   bool tick();
+   void step();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   uint8_t     _columns;
+   uint16_t    _interval;
+   uint32_t    _lastStep;
+   uint8_t     _shift;                             //DDRAM position of the 1-st column, quantity of left shifts modulo line size
+   uint8_t     _lineSize;                          //40 in 2-line mode, 80 in 1-line mode
+   uint8_t     _rows;                              //DDRAM lines, 2 in 2-line mode, 1 in 1-line mode
+
+   const char *_text[LCD_MARQUEE_ROWS];
+   uint16_t    _length[LCD_MARQUEE_ROWS];
+   uint16_t    _period[LCD_MARQUEE_ROWS];          //text & gap length, line size if text fits into DDRAM line
+   uint16_t    _position[LCD_MARQUEE_ROWS];        //text character at the 1-st column
+   uint8_t     _loaded[LCD_MARQUEE_ROWS];          //quantity of valid DDRAM characters from the 1-st column
+
+   void _lineMode();
+   void _setPeriod(uint8_t row);
+   void _load(uint8_t row, uint8_t from);
+};
+
+#endif
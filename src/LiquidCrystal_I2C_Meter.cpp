@@ -0,0 +1,193 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - horizontal & vertical bar meters with sub-character resolution
+   - partial blocks are 5x8 dots custom characters, horizontal meter takes 4
+     CGRAM slots & vertical meter takes 7 CGRAM slots
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Meter.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Meter()
+
+    Constructor. Defines meter type, position & size
+
+    NOTE:
+    - column & row are the left cell of horizontal meter or the bottom
+      cell of vertical meter, length in characters
+
+    - horizontal meter uses CGRAM slots "firstSlot..firstSlot + 3",
+      vertical meter uses "firstSlot..firstSlot + 6", meters of the
+      same type may share the same slots
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Meter::LiquidCrystal_I2C_Meter(LiquidCrystal_I2C_Base &lcd, lcdMeterType type, uint8_t column, uint8_t row, uint8_t length, uint8_t firstSlot) : _lcd(lcd)
+{
+  _type      = type;
+  _column    = column;
+  _row       = row;
+  _length    = (length != 0) ? length : 1;                                        //safety check, at least one character
+
+  if ((_type == LCD_METER_VERTICAL) && (_length > (_row + 1))) {_length = _row + 1;} //safety check, vertical meter grows up to the first row
+
+  _steps     = (_type == LCD_METER_HORIZONTAL) ? LCD_METER_H_STEPS : LCD_METER_V_STEPS;
+  _firstSlot = constrain(firstSlot, 0, (8 - (_steps - 1)));                       //safety check, partial blocks fit in CGRAM
+  _level     = 0;
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Uploads partial blocks to CGRAM & draws empty meter
+
+    NOTE:
+    - call after "LiquidCrystal_I2C::begin()"
+
+    - horizontal block "n" has "n" left columns filled, vertical
+      block "n" has "n" bottom rows filled
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Meter::begin()
+{
+  uint8_t block[8];
+
+  for (uint8_t n = 1; n < _steps; n++)
+  {
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      if (_type == LCD_METER_HORIZONTAL) {block[i] = (0x1F << (LCD_METER_H_STEPS - n)) & 0x1F;} //"n" left columns
+      else                               {block[i] = (i >= (8 - n)) ? 0x1F : 0x00;}             //"n" bottom rows
+    }
+
+    _lcd.createChar(_firstSlot + n - 1, block);
+  }
+
+  for (uint8_t i = 0; i < _length; i++) {_print(i, LCD_SPACE_SYMBOL);}
+
+  _level = 0;
+}
+
+
+/**************************************************************************/
+/*
+    draw()
+
+    Draws value scaled to meter resolution
+
+    NOTE:
+    - see "drawLevel()" for details
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Meter::draw(uint16_t value, uint16_t maxValue)
+{
+  if (maxValue == 0) {return;}                                                   //safety check, to prevent division by zero
+
+  value = constrain(value, 0, maxValue);
+
+  drawLevel(((uint32_t)value * resolution() + (maxValue / 2)) / maxValue);
+}
+
+
+/**************************************************************************/
+/*
+    drawLevel()
+
+    Draws level in meter steps, "0..resolution()"
+
+    NOTE:
+    - only cells between previous & new level are rewritten, small
+      change costs one character & one DDRAM address
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Meter::drawLevel(uint16_t level)
+{
+  if (level > resolution()) {level = resolution();}
+
+  if (level == _level) {return;}
+
+  uint8_t first = ((level < _level) ? level : _level) / _steps;                  //first changed cell
+  uint8_t last  = (((level > _level) ? level : _level) - 1) / _steps;            //last changed cell
+
+  if (last >= _length) {last = _length - 1;}
+
+  /* horizontal cells are contiguous in DDRAM, one DDRAM address for the whole run */
+  if (_type == LCD_METER_HORIZONTAL)
+  {
+    uint8_t run[LCD_MAX_COLUMNS];
+    uint8_t size = 0;
+
+    for (uint8_t i = first; (i <= last) && (size < LCD_MAX_COLUMNS); i++) {run[size++] = _cell(i, level);}
+
+    _lcd.setCursor(_column + first, _row);
+    _lcd.write(run, size);
+  }
+  else
+  {
+    for (uint8_t i = first; i <= last; i++) {_print(i, _cell(i, level));}
+  }
+
+  _level = level;
+}
+
+
+/**************************************************************************/
+/*
+    resolution()
+
+    Returns maximum level, in steps
+*/
+/**************************************************************************/
+uint16_t LiquidCrystal_I2C_Meter::resolution()
+{
+  return (uint16_t)_length * _steps;
+}
+
+
+/**************************************************************************/
+/*
+    _cell()
+
+    Returns character of the cell for the level
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Meter::_cell(uint8_t index, uint16_t level)
+{
+  uint16_t start = (uint16_t)index * _steps;
+
+  if (level <= start)          {return LCD_SPACE_SYMBOL;}
+  if (level >= start + _steps) {return LCD_METER_FULL_BLOCK;}
+
+  return _firstSlot + (level - start) - 1;                                       //partial block
+}
+
+
+/**************************************************************************/
+/*
+    _print()
+
+    Prints character to the cell
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Meter::_print(uint8_t index, uint8_t character)
+{
+  if (_type == LCD_METER_HORIZONTAL) {_lcd.setCursor(_column + index, _row);}
+  else                               {_lcd.setCursor(_column, _row - index);}
+
+  _lcd.write(character);
+}
@@ -0,0 +1,64 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - horizontal & vertical bar meters with sub-character resolution
+   - partial blocks are 5x8 dots custom characters, horizontal meter takes 4
+     CGRAM slots & vertical meter takes 7 CGRAM slots
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Meter_h
+#define LiquidCrystal_I2C_Meter_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_METER_H_STEPS        5      //horizontal steps per character, 5-dots character width
+#define LCD_METER_V_STEPS        8      //vertical steps per character, 8-dots character height
+#define LCD_METER_FULL_BLOCK     0xFF   //"solid square" symbol from LCD ROM, see p.17 & p.30 of HD44780 datasheet
+
+
+typedef enum : uint8_t
+{
+  LCD_METER_HORIZONTAL = 0x00,          //grows from left to right
+  LCD_METER_VERTICAL   = 0x01           //grows from bottom to top
+}
+lcdMeterType;
+
+
+class LiquidCrystal_I2C_Meter
+{
+  public:
+   LiquidCrystal_I2C_Meter(LiquidCrystal_I2C_Base &lcd, lcdMeterType type, uint8_t column, uint8_t row, uint8_t length, uint8_t firstSlot = 0);
+
+   void     begin();
+   void     draw(uint16_t value, uint16_t maxValue);
+   void     drawLevel(uint16_t level);
+   uint16_t resolution();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   lcdMeterType _type;
+   uint8_t      _column;
+   uint8_t      _row;
+   uint8_t      _length;
+   uint8_t      _firstSlot;
+   uint8_t      _steps;
+   uint16_t     _level;                 //drawn level, in steps
+
+   uint8_t _cell(uint8_t index, uint16_t level);
+   void    _print(uint8_t index, uint8_t character);
+};
+
+#endif
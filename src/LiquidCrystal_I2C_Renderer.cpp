@@ -0,0 +1,175 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - calls user draw function & sends framebuffer at fixed refresh rate
+   - frames which don't fit into time budget are dropped, the next
+     frame shows the latest state
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Renderer.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Renderer()
+
+    Constructor. Defines draw function & refresh rate
+
+    NOTE:
+    - draw function prints the whole screen, enable framebuffer with
+      "LiquidCrystal_I2C::enableFramebuffer()", so printing goes to MCU
+      memory & only changed characters are sent by "flush()"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Renderer::LiquidCrystal_I2C_Renderer(LiquidCrystal_I2C_Base &lcd, lcdDrawCallback draw, uint8_t fps) : _lcd(lcd)
+{
+  _draw    = draw;
+  _started = false;
+
+  setRefreshRate(fps);
+  resetStats();
+}
+
+
+/**************************************************************************/
+/*
+    setRefreshRate()
+
+    Sets frames per second, 1..100
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Renderer::setRefreshRate(uint8_t fps)
+{
+  fps = constrain(fps, 1, LCD_RENDER_MAX_FPS);
+
+  _period = 1000000UL / fps;
+}
+
+
+/**************************************************************************/
+/*
+    tick()
+
+    Draws & sends frame if frame time is elapsed, returns true if frame
+    was sent
+
+    NOTE:
+    - doesn't block except draw & "flush()", call from "loop()" as often
+      as possible
+
+    - if previous frame took longer than frame time, all missed frames
+      are dropped & frames stay aligned to the refresh rate
+
+    - in queue mode frame is dropped while the previous frame is still
+      in queue, see "LiquidCrystal_I2C::enableQueue()", so slow bus gets
+      fewer frames instead of growing backlog
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Renderer::tick()
+{
+  uint32_t now = micros();
+
+  if (_started == false)
+  {
+    _started   = true;
+    _nextFrame = now;
+  }
+
+  if ((int32_t)(now - _nextFrame) < 0) {return false;}                       //too early
+
+  uint32_t late = now - _nextFrame;
+
+  if (late >= _period)                                                       //previous frame or user code overran budget
+  {
+    _stats.dropped += late / _period;
+    _nextFrame     += (late / _period) * _period;
+  }
+
+  _nextFrame += _period;
+
+  if (_lcd.queueLength() != 0) {_stats.dropped++; return false;}             //previous frame is still sent
+
+  render();
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    render()
+
+    Draws & sends frame now, outside of refresh rate
+
+    NOTE:
+    - also updates statistics, see "getStats()"
+
+    - fps is updated by the 1-st frame of the next second only, it
+      isn't changed while nothing is rendered
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Renderer::render()
+{
+  uint32_t startTime = micros();
+
+  if (_draw != NULL) {_draw(_lcd);}
+
+  _lcd.flush();                                                              //framebuffer changes only
+
+  uint32_t flushTime = micros() - startTime;
+
+  if (flushTime > _stats.worstFlushTime) {_stats.worstFlushTime = flushTime;}
+
+  uint32_t seconds = (startTime - _secondStart) / 1000000UL;                 //this frame belongs to the next second
+
+  if (seconds != 0)
+  {
+    _stats.fps     = (seconds == 1) ? _secondFrames : 0;                     //nothing sent during the last second of idle time
+    _secondFrames  = 0;
+    _secondStart  += 1000000UL * seconds;                                    //whole seconds, idle time included
+  }
+
+  _stats.frames++;
+  _secondFrames++;
+}
+
+
+/**************************************************************************/
+/*
+    getStats()
+
+    Returns sent & dropped frames, the longest frame time & frames
+    sent during the last second
+*/
+/**************************************************************************/
+lcdRenderStats LiquidCrystal_I2C_Renderer::getStats()
+{
+  return _stats;
+}
+
+
+/**************************************************************************/
+/*
+    resetStats()
+
+    Clears frame statistics
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Renderer::resetStats()
+{
+  memset(&_stats, 0, sizeof(_stats));
+
+  _secondStart  = micros();
+  _secondFrames = 0;
+}
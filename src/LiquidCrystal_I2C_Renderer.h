@@ -0,0 +1,66 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - calls user draw function & sends framebuffer at fixed refresh rate
+   - frames which don't fit into time budget are dropped, the next
+     frame shows the latest state
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Renderer_h
+#define LiquidCrystal_I2C_Renderer_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_RENDER_FPS           10     //default refresh rate, liquid crystal response time ~100msec
+#define LCD_RENDER_MAX_FPS       100
+
+
+typedef void (*lcdDrawCallback)(LiquidCrystal_I2C_Base &lcd);
+
+
+typedef struct
+{
+  uint32_t frames;                      //sent frames
+  uint32_t dropped;                     //frames skipped because the previous one was late or still in queue
+  uint32_t worstFlushTime;              //the longest draw & "flush()", in microseconds
+  uint8_t  fps;                         //frames sent during the last second
+}
+lcdRenderStats;
+
+
+class LiquidCrystal_I2C_Renderer
+{
+  public:
+   LiquidCrystal_I2C_Renderer(LiquidCrystal_I2C_Base &lcd, lcdDrawCallback draw, uint8_t fps = LCD_RENDER_FPS);
+
+   void           setRefreshRate(uint8_t fps);
+   bool           tick();
+   void           render();
+   lcdRenderStats getStats();
+   void           resetStats();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+   lcdDrawCallback         _draw;
+
+   uint32_t       _period;                                                          //frame time budget, in microseconds
+   uint32_t       _nextFrame;                                                       //start time of the next frame, in microseconds
+   bool           _started;
+   uint32_t       _secondStart;                                                     //fps measurement window, in microseconds
+   uint8_t        _secondFrames;
+   lcdRenderStats _stats;
+};
+
+#endif
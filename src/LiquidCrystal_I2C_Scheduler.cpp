@@ -0,0 +1,122 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - shares one I2C bus between several LCD, while one LCD executes
+     command the bus is used by another LCD
+   - every LCD must be in queue mode, see "enableQueue()"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Scheduler.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Scheduler()
+
+    Constructor
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Scheduler::LiquidCrystal_I2C_Scheduler()
+{
+  _count = 0;
+  _next  = 0;
+}
+
+
+/**************************************************************************/
+/*
+    add()
+
+    Adds LCD to the group
+
+    NOTE:
+    - call after "begin()" & "enableQueue()" of the LCD
+
+    - returns false if group is full, maximum 8 LCD
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Scheduler::add(LiquidCrystal_I2C_Base &lcd)
+{
+  if (_count >= LCD_SCHEDULER_MAX_DISPLAYS) {return false;}
+
+  _lcd[_count++] = &lcd;
+
+  return true;
+}
+
+
+/**************************************************************************/
+/*
+    tick()
+
+    Gives every LCD which is ready one I2C transaction
+
+    NOTE:
+    - never waits, LCD which still executes command is skipped, so
+      while one LCD executes "clear()" others receive data
+
+    - LCD are served in turn, the first LCD of the next call is the
+      second LCD of this call, so no LCD is starving
+
+    - "maxCommands" per LCD, see "LiquidCrystal_I2C::tick()"
+
+    - returns true if any queue is not empty
+*/
+/**************************************************************************/
+bool LiquidCrystal_I2C_Scheduler::tick(uint8_t maxCommands)
+{
+  bool pending = false;
+
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    if (_lcd[(_next + i) % _count]->tick(maxCommands) == true) {pending = true;}
+  }
+
+  if (_count != 0) {_next = (_next + 1) % _count;}
+
+  return pending;
+}
+
+
+/**************************************************************************/
+/*
+    flush()
+
+    Sends all queued commands & characters of all LCD
+
+    NOTE:
+    - blocks until all queues are empty, LCD are still interleaved
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Scheduler::flush()
+{
+  while (tick() == true) {}
+}
+
+
+/**************************************************************************/
+/*
+    queueLength()
+
+    Returns quantity of queued commands & characters of all LCD
+*/
+/**************************************************************************/
+uint16_t LiquidCrystal_I2C_Scheduler::queueLength()
+{
+  uint16_t length = 0;
+
+  for (uint8_t i = 0; i < _count; i++) {length += _lcd[i]->queueLength();}
+
+  return length;
+}
@@ -0,0 +1,46 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - shares one I2C bus between several LCD, while one LCD executes
+     command the bus is used by another LCD
+   - every LCD must be in queue mode, see "enableQueue()"
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Scheduler_h
+#define LiquidCrystal_I2C_Scheduler_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_SCHEDULER_MAX_DISPLAYS 8    //PCF8574 has 8 addresses, see "pcf8574Address"
+
+
+class LiquidCrystal_I2C_Scheduler
+{
+  public:
+   LiquidCrystal_I2C_Scheduler();
+
+   bool     add(LiquidCrystal_I2C_Base &lcd);
+   bool     tick(uint8_t maxCommands = 0xFF);
+   void     flush();
+   uint16_t queueLength();
+
+  private:
+   LiquidCrystal_I2C_Base *_lcd[LCD_SCHEDULER_MAX_DISPLAYS];
+
+   uint8_t _count;
+   uint8_t _next;                       //LCD served first on the next "tick()"
+};
+
+#endif
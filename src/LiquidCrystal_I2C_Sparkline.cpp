@@ -0,0 +1,198 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - scrolling time-series chart drawn on 5x8 dots custom characters
+   - every character is 5 samples wide & 8 pixels high, chart takes up to
+     8 characters & one CGRAM slot per character
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Sparkline.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Sparkline()
+
+    Constructor. Defines chart position & width
+
+    NOTE:
+    - chart uses CGRAM slots "firstSlot..firstSlot + cells - 1"
+
+    - default range is 0..1023, see "setRange()"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Sparkline::LiquidCrystal_I2C_Sparkline(LiquidCrystal_I2C_Base &lcd, uint8_t column, uint8_t row, uint8_t cells, uint8_t firstSlot) : _lcd(lcd)
+{
+  _column    = column;
+  _row       = row;
+  _firstSlot = constrain(firstSlot, 0, (LCD_SPARKLINE_MAX_CELLS - 1));
+  _cells     = constrain(cells, 1, (LCD_SPARKLINE_MAX_CELLS - _firstSlot)); //safety check, chart fits in CGRAM
+  _minValue  = 0;
+  _maxValue  = 1023;
+  _head      = 0;
+  _count     = 0;
+}
+
+
+/**************************************************************************/
+/*
+    begin()
+
+    Uploads empty chart to CGRAM & prints chart characters
+
+    NOTE:
+    - call after "LiquidCrystal_I2C::begin()"
+
+    - chart characters are printed only once, after that every
+      "push()" updates CGRAM only
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Sparkline::begin()
+{
+  _render(true);
+
+  _lcd.setCursor(_column, _row);
+
+  for (uint8_t i = 0; i < _cells; i++) {_lcd.write(_firstSlot + i);}
+}
+
+
+/**************************************************************************/
+/*
+    setRange()
+
+    Sets values shown at the bottom & at the top of the chart
+
+    NOTE:
+    - applies to new samples only
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Sparkline::setRange(int16_t minValue, int16_t maxValue)
+{
+  if (minValue >= maxValue) {return;} //safety check, to prevent division by zero
+
+  _minValue = minValue;
+  _maxValue = maxValue;
+}
+
+
+/**************************************************************************/
+/*
+    push()
+
+    Adds new sample at the right side of the chart & scrolls chart
+    to the left
+
+    NOTE:
+    - only CGRAM rows which differ from previous frame are sent,
+      flat signal costs few bytes per sample
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Sparkline::push(int16_t value)
+{
+  uint8_t samples = _cells * LCD_SPARKLINE_WIDTH;
+
+  value = constrain(value, _minValue, _maxValue);
+
+  uint8_t pixel = (((int32_t)value - _minValue) * (LCD_SPARKLINE_HEIGHT - 1) + (((int32_t)_maxValue - _minValue) / 2)) / ((int32_t)_maxValue - _minValue); //16-bit "int" on AVR, cast before subtraction
+
+  if (_count < samples)
+  {
+    _history[(_head + _count) % samples] = pixel;
+    _count++;
+  }
+  else
+  {
+    _history[_head] = pixel;                           //overwrite oldest sample
+    _head = (_head + 1) % samples;
+  }
+
+  _render(false);
+}
+
+
+/**************************************************************************/
+/*
+    clear()
+
+    Removes all samples from the chart
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Sparkline::clear()
+{
+  _head  = 0;
+  _count = 0;
+
+  _render(false);
+}
+
+
+/**************************************************************************/
+/*
+    _render()
+
+    Draws samples to CGRAM rows & sends changed rows
+
+    NOTE:
+    - newest sample is the rightmost dot, chart is empty on the left
+      until history is full
+
+    - consecutive changed rows are sent in one CGRAM write, unchanged
+      gaps up to "LCD_FLUSH_MERGE_GAP" rows are resent instead of new
+      CGRAM address
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Sparkline::_render(bool all)
+{
+  uint8_t frame[LCD_SPARKLINE_MAX_CELLS * LCD_SPARKLINE_HEIGHT];
+  uint8_t size    = _cells * LCD_SPARKLINE_HEIGHT;
+  uint8_t samples = _cells * LCD_SPARKLINE_WIDTH;
+  uint8_t empty   = samples - _count;                  //empty dot columns on the left
+
+  memset(frame, 0x00, size);
+
+  for (uint8_t x = empty; x < samples; x++)
+  {
+    uint8_t pixel = _history[(_head + x - empty) % samples];
+
+    frame[((x / LCD_SPARKLINE_WIDTH) * LCD_SPARKLINE_HEIGHT) + (LCD_SPARKLINE_HEIGHT - 1 - pixel)] |= 0x10 >> (x % LCD_SPARKLINE_WIDTH);
+  }
+
+  /* send runs of changed rows */
+  uint8_t i = 0;
+
+  while (i < size)
+  {
+    if ((all == false) && (frame[i] == _cgram[i])) {i++; continue;}
+
+    uint8_t start = i;
+    uint8_t end   = i + 1;                             //end of run, exclusive
+
+    for (uint8_t j = end; j < size; j++)
+    {
+      if ((all == true) || (frame[j] != _cgram[j]))
+      {
+        if ((j - end) > LCD_FLUSH_MERGE_GAP) {break;}  //gap is too long, new CGRAM address is cheaper
+
+        end = j + 1;
+      }
+    }
+
+    _lcd.writeCGRAM((_firstSlot * LCD_SPARKLINE_HEIGHT) + start, &frame[start], end - start);
+
+    i = end;
+  }
+
+  memcpy(_cgram, frame, size);
+}
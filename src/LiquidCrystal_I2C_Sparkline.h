@@ -0,0 +1,61 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - scrolling time-series chart drawn on 5x8 dots custom characters
+   - every character is 5 samples wide & 8 pixels high, chart takes up to
+     8 characters & one CGRAM slot per character
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Sparkline_h
+#define LiquidCrystal_I2C_Sparkline_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+#define LCD_SPARKLINE_MAX_CELLS  8                                                  //one CGRAM slot per character
+#define LCD_SPARKLINE_WIDTH      5                                                  //samples per character, 5-dots character width
+#define LCD_SPARKLINE_HEIGHT     8                                                  //pixels per character, 8-dots character height
+#define LCD_SPARKLINE_SAMPLES    (LCD_SPARKLINE_MAX_CELLS * LCD_SPARKLINE_WIDTH)    //history length, in samples
+
+
+class LiquidCrystal_I2C_Sparkline
+{
+  public:
+   LiquidCrystal_I2C_Sparkline(LiquidCrystal_I2C_Base &lcd, uint8_t column, uint8_t row, uint8_t cells, uint8_t firstSlot = 0);
+
+   void begin();
+   void setRange(int16_t minValue, int16_t maxValue);
+   void push(int16_t value);
+   void clear();
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   uint8_t _column;
+   uint8_t _row;
+   uint8_t _cells;
+   uint8_t _firstSlot;
+   int16_t _minValue;
+   int16_t _maxValue;
+
+   uint8_t _history[LCD_SPARKLINE_SAMPLES];                                         //ring buffer of samples, in pixels 0..7
+   uint8_t _head;                                                                   //oldest sample
+   uint8_t _count;
+
+   uint8_t _cgram[LCD_SPARKLINE_MAX_CELLS * LCD_SPARKLINE_HEIGHT];                  //copy of chart rows in CGRAM
+
+   void _render(bool all);
+};
+
+#endif
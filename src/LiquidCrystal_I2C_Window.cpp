@@ -0,0 +1,254 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - rectangular part of the screen with its own cursor, text wraps
+     to the next row of the window or is clipped at the right edge
+   - DDRAM address is sent only if the next character isn't adjacent
+     to the previous one
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#include "LiquidCrystal_I2C_Window.h"
+
+
+/**************************************************************************/
+/*
+    LiquidCrystal_I2C_Window()
+
+    Constructor. Defines window position & size on the screen
+
+    NOTE:
+    - window must fit into the screen, LCD clamps cursor to the last
+      column & row, see "LiquidCrystal_I2C::setCursor()"
+*/
+/**************************************************************************/
+LiquidCrystal_I2C_Window::LiquidCrystal_I2C_Window(LiquidCrystal_I2C_Base &lcd, uint8_t column, uint8_t row, uint8_t width, uint8_t height, lcdWindowMode mode) : _lcd(lcd)
+{
+  _column       = column;
+  _row          = row;
+  _width        = constrain(width,  1, LCD_MAX_COLUMNS);
+  _height       = constrain(height, 1, 4);
+  _mode         = mode;
+  _cursorColumn = 0;
+  _cursorRow    = 0;
+}
+
+
+/**************************************************************************/
+/*
+    setCursor()
+
+    Sets window cursor position
+
+    NOTE:
+    - cursor position range (0, 0)..(width - 1, height - 1)
+    - nothing is sent to LCD, DDRAM address is set by the next "write()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Window::setCursor(uint8_t column, uint8_t row)
+{
+  _cursorColumn = constrain(column, 0, (_width  - 1));
+  _cursorRow    = constrain(row,    0, (_height - 1));
+}
+
+
+/**************************************************************************/
+/*
+    home()
+
+    Moves window cursor to the top left corner of the window
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Window::home()
+{
+  setCursor(0, 0);
+}
+
+
+/**************************************************************************/
+/*
+    clear()
+
+    Fills window with spaces & moves window cursor to the top left corner
+
+    NOTE:
+    - rest of the screen stays unchanged, unlike "LiquidCrystal_I2C::clear()"
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Window::clear()
+{
+  for (uint8_t row = 0; row < _height; row++) {_fill(row, 0, _width);}
+
+  home();
+}
+
+
+/**************************************************************************/
+/*
+    clearToEndOfLine()
+
+    Fills window row with spaces from cursor to the right edge
+
+    NOTE:
+    - window cursor stays unchanged, call after "print()" of shorter
+      value to erase the rest of the old one
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Window::clearToEndOfLine()
+{
+  if (_cursorColumn >= _width) {return;}                             //clipped, see "write()"
+
+  _fill(_cursorRow, _cursorColumn, (_width - _cursorColumn));
+}
+
+
+/**************************************************************************/
+/*
+    setMode()
+
+    Sets wrap or clip of text at the right edge of the window
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Window::setMode(lcdWindowMode mode)
+{
+  _mode = mode;
+}
+
+
+/**************************************************************************/
+/*
+    getColumn()
+
+    Returns window cursor column
+
+    NOTE:
+    - "width" if text is clipped at the right edge
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Window::getColumn()
+{
+  return _cursorColumn;
+}
+
+
+/**************************************************************************/
+/*
+    getRow()
+
+    Returns window cursor row
+*/
+/**************************************************************************/
+uint8_t LiquidCrystal_I2C_Window::getRow()
+{
+  return _cursorRow;
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Writes character to window at window cursor position & moves cursor
+
+    NOTE:
+    - see "write(const uint8_t *buffer, size_t size)" for details
+*/
+/**************************************************************************/
+size_t LiquidCrystal_I2C_Window::write(uint8_t character)
+{
+  return write(&character, 1);
+}
+
+
+/**************************************************************************/
+/*
+    write()
+
+    Writes characters to window at window cursor position & moves cursor
+
+    NOTE:
+    - "\r" moves cursor to the 1-st column, "\n" to the 1-st column of
+      the next row, so "println()" works inside window
+
+    - with LCD_WINDOW_WRAP text continues on the next row of the window
+      & wraps from the last row to the 1-st one, with LCD_WINDOW_CLIP
+      text after the right edge is dropped
+
+    - characters between control symbols & window edges are sent as one
+      run, DDRAM address is sent only if LCD address counter doesn't
+      point to the run already, see "LiquidCrystal_I2C::setCursor()"
+
+    - "left to right" text direction only
+*/
+/**************************************************************************/
+size_t LiquidCrystal_I2C_Window::write(const uint8_t *buffer, size_t size)
+{
+  size_t i = 0;
+
+  while (i < size)
+  {
+    if (buffer[i] == '\r') {_cursorColumn = 0; i++; continue;}
+
+    if (buffer[i] == '\n')
+    {
+      _cursorColumn = 0;
+      _cursorRow    = (_cursorRow + 1) % _height;
+
+      i++;
+
+      continue;
+    }
+
+    if (_cursorColumn >= _width)                                     //right edge
+    {
+      if (_mode == LCD_WINDOW_CLIP) {i++; continue;}                 //drop character
+
+      _cursorColumn = 0;
+      _cursorRow    = (_cursorRow + 1) % _height;
+    }
+
+    /* find the end of run, printable characters before control symbol or right edge */
+    size_t length = 0;
+
+    while (((i + length) < size) && ((_cursorColumn + length) < _width) && (buffer[i + length] != '\r') && (buffer[i + length] != '\n')) {length++;}
+
+    _lcd.setCursor(_column + _cursorColumn, _row + _cursorRow);      //skipped if address counter points here
+    _lcd.write(&buffer[i], length);
+
+    _cursorColumn += length;
+    i             += length;
+  }
+
+  return size;
+}
+
+
+/**************************************************************************/
+/*
+    _fill()
+
+    Fills part of window row with spaces
+
+    NOTE:
+    - window cursor stays unchanged
+*/
+/**************************************************************************/
+void LiquidCrystal_I2C_Window::_fill(uint8_t row, uint8_t column, uint8_t size)
+{
+  uint8_t spaces[LCD_MAX_COLUMNS];
+
+  memset(spaces, LCD_SPACE_SYMBOL, size);
+
+  _lcd.setCursor(_column + column, _row + row);
+  _lcd.write(spaces, size);
+}
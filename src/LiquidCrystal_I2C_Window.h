@@ -0,0 +1,66 @@
+/***************************************************************************************************/
+/*
+   This is an Arduino library for HD44780, S6A0069, KS0066U, NT3881D, LC7985, ST7066, SPLC780,
+   WH160xB, AIP31066, GDM200xD, ADM0802A LCD displays
+
+   written by : enjoyneering
+   sourse code: https://github.com/enjoyneering/
+
+   NOTE:
+   - rectangular part of the screen with its own cursor, text wraps
+     to the next row of the window or is clipped at the right edge
+   - DDRAM address is sent only if the next character isn't adjacent
+     to the previous one
+
+
+   GNU GPL license, all text above must be included in any redistribution,
+   see link for details - https://www.gnu.org/licenses/licenses.html
+*/
+/***************************************************************************************************/
+
+#ifndef LiquidCrystal_I2C_Window_h
+#define LiquidCrystal_I2C_Window_h
+
+#include "LiquidCrystal_I2C.h"
+
+
+typedef enum : uint8_t
+{
+  LCD_WINDOW_WRAP = 0x00,                                                           //text continues on the next row of the window
+  LCD_WINDOW_CLIP = 0x01                                                            //text after the right edge is dropped until "\n" or "setCursor()"
+}
+lcdWindowMode;
+
+
+class LiquidCrystal_I2C_Window : public Print
+{
+  public:
+   LiquidCrystal_I2C_Window(LiquidCrystal_I2C_Base &lcd, uint8_t column, uint8_t row, uint8_t width, uint8_t height = 1, lcdWindowMode mode = LCD_WINDOW_WRAP);
+
+   void    setCursor(uint8_t column, uint8_t row);
+   void    home();
+   void    clear();
+   void    clearToEndOfLine();
+   void    setMode(lcdWindowMode mode);
+   uint8_t getColumn();
+   uint8_t getRow();
+
+   size_t write(uint8_t character);
+   size_t write(const uint8_t *buffer, size_t size);
+   using  Print::write;
+
+  private:
+   LiquidCrystal_I2C_Base &_lcd;
+
+   uint8_t       _column;                                                           //window position on the screen
+   uint8_t       _row;
+   uint8_t       _width;
+   uint8_t       _height;
+   lcdWindowMode _mode;
+   uint8_t       _cursorColumn;                                                     //cursor position in the window
+   uint8_t       _cursorRow;
+
+   void _fill(uint8_t row, uint8_t column, uint8_t size);
+};
+
+#endif